@@ -0,0 +1,292 @@
+// microbenchmarks de la logique du jeu (tetris_core), sans OpenGL
+// chaque mesure tourne sur des terrains remplis a partir d'une graine, pour comparer
+// les representations du terrain avec des chiffres: ns/op et allocations/op
+//
+// usage: bench_core [--seed N] [--ops N]
+#include "GameField.h"
+#include "PieceBag.h"
+#include "Random.h"
+#include "Log.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <new>
+
+// compteur d'allocations: tout operator new du process passe par ici
+static long allocationCount = 0;
+static bool countAllocations = false;
+
+void* operator new(std::size_t size) {
+    if (countAllocations) allocationCount++;
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) throw std::bad_alloc();
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+struct BenchOptions {
+    uint64_t seed = 1;
+    long ops = 200000;
+};
+
+// remplissages representatifs: hauteur de la pile et proportion de trous
+struct Fill {
+    const char* name;
+    int rows;
+};
+
+static const Fill FILLS[] = {
+    {"empty", 0},
+    {"low", 4},
+    {"mid", 8},
+    {"high", 12}
+};
+
+// resultat d'une mesure: ce qui se passe entre start() et stop(), hors preparation
+class Timer {
+public:
+    void start() {
+        allocationsAtStart = allocationCount;
+        countAllocations = true;
+        begin = std::chrono::steady_clock::now();
+    }
+
+    void stop(long ops) {
+        auto end = std::chrono::steady_clock::now();
+        countAllocations = false;
+        elapsed += std::chrono::duration<double, std::nano>(end - begin).count();
+        allocations += allocationCount - allocationsAtStart;
+        count += ops;
+    }
+
+    double nsPerOp() const { return count > 0 ? elapsed / count : 0.0; }
+    double allocationsPerOp() const { return count > 0 ? static_cast<double>(allocations) / count : 0.0; }
+
+private:
+    std::chrono::steady_clock::time_point begin;
+    long allocationsAtStart = 0;
+    double elapsed = 0.0;
+    long allocations = 0;
+    long count = 0;
+};
+
+// le resultat part ici pour que le compilateur ne supprime pas le travail mesure
+static volatile long sink = 0;
+
+static std::vector<std::string> makeRows(const Fill& fill, Random& random) {
+    // lignes du haut vers le bas pour loadBoard, deux ou trois trous par ligne
+    std::vector<std::string> rows(GameField::FIELD_HEIGHT, std::string(GameField::FIELD_WIDTH, '.'));
+    for (int y = 0; y < fill.rows; y++) {
+        std::string& row = rows[GameField::FIELD_HEIGHT - 1 - y];
+        for (int x = 0; x < GameField::FIELD_WIDTH; x++) {
+            row[x] = "ITSZJL"[random.nextBelow(6)];
+        }
+        int holes = 2 + static_cast<int>(random.nextBelow(2));
+        for (int i = 0; i < holes; i++) {
+            row[random.nextBelow(GameField::FIELD_WIDTH)] = '.';
+        }
+    }
+    return rows;
+}
+
+static std::vector<Piece> makePieces(Random& random, int count) {
+    // positions au hasard autour du terrain, valides ou non
+    std::vector<Piece> pieces;
+    pieces.reserve(count);
+    for (int i = 0; i < count; i++) {
+        Piece piece(static_cast<PieceType>(random.nextBelow(PieceShapes::TYPE_COUNT)),
+                    static_cast<int>(random.nextBelow(GameField::FIELD_WIDTH)),
+                    static_cast<int>(random.nextBelow(GameField::FIELD_HEIGHT + 2)));
+        for (uint32_t r = random.nextBelow(PieceShapes::ROTATION_COUNT); r > 0; r--) {
+            piece.rotate(1);
+        }
+        pieces.push_back(piece);
+    }
+    return pieces;
+}
+
+static std::vector<Piece> makeLandingPieces(const GameField& game, const std::vector<Piece>& pieces) {
+    // memes pieces avec leur rotation, ramenees dans le terrain et au dessus de la pile:
+    // chaque mesure est un placement legal, comme la piece courante du jeu
+    std::vector<Piece> landing;
+    landing.reserve(pieces.size());
+    for (Piece piece : pieces) {
+        const PieceShapes::Mask& mask = piece.getMask();
+        int x = std::min(std::max(piece.getX(), -mask.minX), GameField::FIELD_WIDTH - mask.width - mask.minX);
+        piece.setPosition(x, GameField::FIELD_HEIGHT);
+        if (game.isValidPosition(piece)) {
+            landing.push_back(piece);
+        }
+    }
+    return landing;
+}
+
+static void report(const char* name, const Fill& fill, const Timer& timer) {
+    std::cout << std::left << std::setw(22) << name << std::setw(7) << fill.name
+              << std::right << std::fixed << std::setprecision(1) << std::setw(10) << timer.nsPerOp() << " ns/op"
+              << std::setprecision(2) << std::setw(8) << timer.allocationsPerOp() << " allocs/op" << std::endl;
+}
+
+static void benchFill(const Fill& fill, const BenchOptions& options) {
+    Random random(options.seed * 31 + fill.rows);
+    std::vector<std::string> rows = makeRows(fill, random);
+    std::vector<Piece> pieces = makePieces(random, 1024);
+    
+    Timer validTimer, blocksTimer, clearTimer, landingTimer, dropTimer, spawnTimer, tickTimer;
+    
+    {
+        GameField game(options.seed);
+        game.loadBoard(rows);
+        
+        // isValidPosition: le test de collision de toutes les entrees et de la gravite
+        validTimer.start();
+        long valid = 0;
+        for (long i = 0; i < options.ops; i++) {
+            valid += game.isValidPosition(pieces[i & 1023]);
+        }
+        validTimer.stop(options.ops);
+        sink = valid;
+        
+        // getBlockPositions: les 4 cases d'une piece, utilisees au lock et au rendu
+        blocksTimer.start();
+        long sum = 0;
+        for (long i = 0; i < options.ops; i++) {
+            for (const auto& block : pieces[i & 1023].getBlockPositions()) {
+                sum += block.x + block.y;
+            }
+        }
+        blocksTimer.stop(options.ops);
+        sink = sum;
+        
+        // checkAndClearLines: compaction sur une copie du terrain avec 4 lignes pleines au milieu
+        Board full = game.getBoard();
+        for (int y = 0; y < 4 && y < GameField::FIELD_HEIGHT; y++) {
+            for (int x = 0; x < GameField::FIELD_WIDTH; x++) {
+                full.setCell(x, y * 2, Piece::getTypeColor(PieceType::I));
+            }
+        }
+        // les copies sont refaites hors mesure, par lots qui tiennent dans le cache
+        const long CLEAR_BATCH = 256;
+        std::vector<Board> boards(CLEAR_BATCH);
+        long cleared = 0;
+        for (long done = 0; done < options.ops; done += CLEAR_BATCH) {
+            long batch = std::min(CLEAR_BATCH, options.ops - done);
+            std::fill(boards.begin(), boards.begin() + batch, full);
+            clearTimer.start();
+            for (long i = 0; i < batch; i++) {
+                cleared += boards[i].clearFullRows();
+            }
+            clearTimer.stop(batch);
+        }
+        sink = cleared;
+        
+        // landing d'un hard drop, sans le lock
+        std::vector<Piece> landingPieces = makeLandingPieces(game, pieces);
+        if (!landingPieces.empty()) {
+            landingTimer.start();
+            long landing = 0;
+            for (long i = 0; i < options.ops; i++) {
+                game.placePiece(landingPieces[i % landingPieces.size()]);
+                landing += game.getLandingY();
+            }
+            landingTimer.stop(options.ops);
+            sink = landing;
+        }
+    }
+    
+    {
+        GameField game(options.seed);
+        PieceBag bag(options.seed);
+        long done = 0;
+        
+        // hard drop complet: landing, lock, lignes, piece suivante
+        // le terrain est recharge (hors mesure) avant qu'il deborde
+        while (done < options.ops / 8) {
+            game.loadBoard(rows);
+            game.placePiece(bag.next(), GameField::FIELD_WIDTH / 2, GameField::FIELD_HEIGHT);
+            dropTimer.start();
+            int drops = 0;
+            for (; drops < 4 && !game.isGameOver(); drops++) {
+                game.dropCurrentPiece();
+            }
+            dropTimer.stop(drops);
+            done += drops > 0 ? drops : 1;
+        }
+        
+        // spawn: piece suivante du sac et test de placement, comme spawnNewPiece()
+        spawnTimer.start();
+        long spawned = 0;
+        for (long i = 0; i < options.ops; i++) {
+            Piece piece(bag.next(), GameField::FIELD_WIDTH / 2, GameField::FIELD_HEIGHT);
+            spawned += game.isValidPosition(piece);
+        }
+        spawnTimer.stop(options.ops);
+        sink = spawned;
+        
+        // tick complet avec la gravite a chaque tick: chute, lock, lignes et spawn quand la piece touche
+        game.setGravityTicks(1);
+        done = 0;
+        while (done < options.ops) {
+            game.loadBoard(rows);
+            game.placePiece(bag.next(), GameField::FIELD_WIDTH / 2, GameField::FIELD_HEIGHT);
+            tickTimer.start();
+            int ticks = 0;
+            for (; ticks < 64 && !game.isGameOver(); ticks++) {
+                game.tick();
+            }
+            tickTimer.stop(ticks);
+            done += ticks > 0 ? ticks : 1;
+        }
+    }
+    
+    report("isValidPosition", fill, validTimer);
+    report("getBlockPositions", fill, blocksTimer);
+    report("checkAndClearLines", fill, clearTimer);
+    report("hardDrop landing", fill, landingTimer);
+    report("hardDrop + lock", fill, dropTimer);
+    report("spawn", fill, spawnTimer);
+    report("update tick", fill, tickTimer);
+}
+
+static bool parseArguments(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--seed" && hasValue) options.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--ops" && hasValue) options.ops = std::max(1L, std::atol(argv[++i]));
+        else {
+            std::cout << "Unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cout << "usage: bench_core [--seed N] [--ops N]" << std::endl;
+        return 1;
+    }
+    
+    // le jeu logue chaque clear et game over: seuls les avertissements passent pendant les mesures
+    Log::setLevel(LogLevel::WARNING);
+    
+    std::cout << "seed " << options.seed << ", " << options.ops << " ops per measure" << std::endl;
+    for (const Fill& fill : FILLS) {
+        benchFill(fill, options);
+    }
+    return 0;
+}
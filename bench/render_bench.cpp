@@ -0,0 +1,331 @@
+// benchmark de rendu sans fenetre: contexte EGL surfaceless (Mesa llvmpipe ou GPU),
+// rendu dans un FBO, etat du terrain scripte pour que l'image soit reproductible
+//
+// usage: render_bench [--scene empty|stack|full] [--frames N] [--width W] [--height H]
+//                     [--warmup N] [--dump image.ppm] [--trace trace.json]
+#include "GameField.h"
+#include "GameRenderer.h"
+#include "RenderStats.h"
+#include "Profiler.h"
+#include "Log.h"
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+
+struct BenchOptions {
+    std::string scene = "stack";
+    int frames = 200;
+    int warmup = 10;
+    int width = 1200;
+    int height = 900;
+    std::string dumpPath;
+    std::string tracePath;
+};
+
+struct HeadlessContext {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+};
+
+static void* loadProc(const char* name) {
+    return reinterpret_cast<void*>(eglGetProcAddress(name));
+}
+
+static bool hasExtension(const char* extensions, const char* name) {
+    return extensions != nullptr && std::strstr(extensions, name) != nullptr;
+}
+
+static bool createContext(HeadlessContext& ctx) {
+    // plateforme surfaceless de Mesa si dispo, sinon l'affichage par defaut
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay != nullptr) {
+            ctx.display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+    }
+    if (ctx.display == EGL_NO_DISPLAY) {
+        ctx.display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    if (ctx.display == EGL_NO_DISPLAY || !eglInitialize(ctx.display, nullptr, nullptr)) {
+        std::cout << "Failed to initialize EGL" << std::endl;
+        return false;
+    }
+
+    const char* displayExtensions = eglQueryString(ctx.display, EGL_EXTENSIONS);
+    if (!hasExtension(displayExtensions, "EGL_KHR_surfaceless_context")) {
+        std::cout << "EGL_KHR_surfaceless_context not supported" << std::endl;
+        return false;
+    }
+
+    // pas de surface: on choisit une config seulement si le driver l'exige
+    EGLConfig config = EGL_NO_CONFIG_KHR;
+    if (!hasExtension(displayExtensions, "EGL_KHR_no_config_context") &&
+        !hasExtension(displayExtensions, "EGL_MESA_configless_context")) {
+        const EGLint configAttribs[] = {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_NONE
+        };
+        EGLint configCount = 0;
+        if (!eglChooseConfig(ctx.display, configAttribs, &config, 1, &configCount) || configCount == 0) {
+            std::cout << "No EGL config for desktop OpenGL" << std::endl;
+            return false;
+        }
+    }
+
+    // meme contexte que le jeu: OpenGL 3.3 core
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    ctx.context = eglCreateContext(ctx.display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (ctx.context == EGL_NO_CONTEXT) {
+        std::cout << "Failed to create OpenGL 3.3 core context" << std::endl;
+        return false;
+    }
+
+    if (!eglMakeCurrent(ctx.display, EGL_NO_SURFACE, EGL_NO_SURFACE, ctx.context)) {
+        std::cout << "Failed to make EGL context current" << std::endl;
+        return false;
+    }
+
+    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(loadProc))) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static void destroyContext(HeadlessContext& ctx) {
+    if (ctx.display == EGL_NO_DISPLAY) return;
+    eglMakeCurrent(ctx.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (ctx.context != EGL_NO_CONTEXT) {
+        eglDestroyContext(ctx.display, ctx.context);
+    }
+    eglTerminate(ctx.display);
+}
+
+static std::vector<std::string> makeScene(const std::string& scene) {
+    // couleurs choisies sans aleatoire pour que le checksum soit stable
+    const char letters[] = "ITSZJL";
+    std::vector<std::string> rows;
+    int filledRows = 0;
+    if (scene == "stack") filledRows = GameField::FIELD_HEIGHT / 2;
+    else if (scene == "full") filledRows = GameField::FIELD_HEIGHT - 3;
+
+    for (int i = 0; i < filledRows; i++) {
+        std::string row(GameField::FIELD_WIDTH, '.');
+        for (int x = 0; x < GameField::FIELD_WIDTH; x++) {
+            // un trou par ligne pour que rien ne soit complet
+            if (x == (i * 3) % GameField::FIELD_WIDTH) continue;
+            row[x] = letters[(x / 2 + i) % 6];
+        }
+        rows.insert(rows.begin(), row);
+    }
+    return rows;
+}
+
+static bool parseArguments(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--scene" && hasValue) options.scene = argv[++i];
+        else if (arg == "--frames" && hasValue) options.frames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && hasValue) options.warmup = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--width" && hasValue) options.width = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--height" && hasValue) options.height = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--dump" && hasValue) options.dumpPath = argv[++i];
+        else if (arg == "--trace" && hasValue) options.tracePath = argv[++i];
+        else {
+            std::cout << "Unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    if (options.scene != "empty" && options.scene != "stack" && options.scene != "full") {
+        std::cout << "Unknown scene: " << options.scene << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static uint64_t checksum(const std::vector<unsigned char>& pixels) {
+    // FNV-1a 64 bits
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char byte : pixels) {
+        hash ^= byte;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void dumpImage(const std::string& path, const std::vector<unsigned char>& pixels, int width, int height) {
+    // PPM binaire, lignes remises dans l'ordre haut -> bas
+    std::ofstream file(path, std::ios::binary);
+    file << "P6\n" << width << " " << height << "\n255\n";
+    for (int y = height - 1; y >= 0; y--) {
+        for (int x = 0; x < width; x++) {
+            file.write(reinterpret_cast<const char*>(&pixels[(y * width + x) * 4]), 3);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseArguments(argc, argv, options)) return 1;
+    // le rapport passe par std::cout: pas de logs du jeu melanges au milieu
+    Log::setLevel(LogLevel::WARNING);
+
+    HeadlessContext ctx;
+    if (!createContext(ctx)) {
+        destroyContext(ctx);
+        return 1;
+    }
+
+    int result = 0;
+    {
+        // cible de rendu: couleur + profondeur
+        unsigned int fbo, colorBuffer, depthBuffer;
+        glGenFramebuffers(1, &fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+        glGenRenderbuffers(1, &colorBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, options.width, options.height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+
+        glGenRenderbuffers(1, &depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, options.width, options.height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cout << "Offscreen framebuffer incomplete" << std::endl;
+            result = 1;
+        }
+
+        glViewport(0, 0, options.width, options.height);
+        glEnable(GL_DEPTH_TEST);
+
+        GameField gameField;
+        gameField.loadBoard(makeScene(options.scene));
+        if (options.scene != "empty") {
+            gameField.placePiece(PieceType::T, GameField::FIELD_WIDTH / 2, GameField::FIELD_HEIGHT - 2);
+        }
+        GameRenderer gameRenderer;
+
+        // une frame = meme travail que la boucle du jeu, glFinish pour compter le GPU
+        std::vector<double> frameTimes;
+        frameTimes.reserve(options.frames);
+        int drawCalls = 0;
+        long vertices = 0;
+        // somme par passe; le GPU n'est compte que sur les frames dont le resultat est revenu
+        double passCpuTotals[RenderStats::PASS_COUNT] = {};
+        double passGpuTotals[RenderStats::PASS_COUNT] = {};
+        int passGpuFrames = 0;
+
+        for (int frame = 0; frame < options.warmup + options.frames && result == 0; frame++) {
+            PROFILE_ZONE("frame");
+            auto start = std::chrono::steady_clock::now();
+
+            RenderStats::beginFrame();
+            glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            gameRenderer.render(gameField);
+            {
+                PROFILE_ZONE("finish");
+                glFinish();
+            }
+
+            auto end = std::chrono::steady_clock::now();
+            if (frame >= options.warmup) {
+                frameTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+                
+                bool gpuReady = true;
+                for (int pass = 0; pass < RenderStats::PASS_COUNT; pass++) {
+                    passCpuTotals[pass] += RenderStats::getPassCpuTime(static_cast<RenderPass>(pass));
+                    gpuReady = gpuReady && RenderStats::getPassGpuTime(static_cast<RenderPass>(pass)) >= 0.0;
+                }
+                if (gpuReady) {
+                    for (int pass = 0; pass < RenderStats::PASS_COUNT; pass++) {
+                        passGpuTotals[pass] += RenderStats::getPassGpuTime(static_cast<RenderPass>(pass));
+                    }
+                    passGpuFrames++;
+                }
+            }
+            drawCalls = RenderStats::getDrawCalls();
+            vertices = RenderStats::getVertices();
+        }
+
+        std::vector<unsigned char> pixels(static_cast<size_t>(options.width) * options.height * 4);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, options.width, options.height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+        GLenum error = glGetError();
+        if (error != GL_NO_ERROR) {
+            std::cout << "GL error: 0x" << std::hex << error << std::dec << std::endl;
+            result = 1;
+        }
+
+        if (result == 0) {
+            std::sort(frameTimes.begin(), frameTimes.end());
+            double total = 0.0;
+            for (double t : frameTimes) total += t;
+
+            std::cout << "renderer:   " << glGetString(GL_RENDERER) << std::endl;
+            std::cout << "scene:      " << options.scene << " (" << options.width << "x" << options.height << ")" << std::endl;
+            std::cout << "frames:     " << frameTimes.size() << std::endl;
+            std::cout << "frame ms:   avg " << total / frameTimes.size()
+                      << " | min " << frameTimes.front()
+                      << " | p50 " << frameTimes[frameTimes.size() / 2]
+                      << " | max " << frameTimes.back() << std::endl;
+            // moyenne par passe: soumission CPU / execution GPU (GL_TIME_ELAPSED)
+            std::cout << "pass ms:   ";
+            for (int pass = 0; pass < RenderStats::PASS_COUNT; pass++) {
+                std::cout << (pass == 0 ? " " : " | ") << RenderStats::getPassName(static_cast<RenderPass>(pass))
+                          << " cpu " << passCpuTotals[pass] / frameTimes.size() << " gpu ";
+                if (passGpuFrames > 0) {
+                    std::cout << passGpuTotals[pass] / passGpuFrames;
+                } else {
+                    std::cout << "n/a";
+                }
+            }
+            std::cout << std::endl;
+            std::cout << "draw calls: " << drawCalls << std::endl;
+            std::cout << "vertices:   " << vertices << std::endl;
+            std::cout << "checksum:   " << std::hex << checksum(pixels) << std::dec << std::endl;
+
+            if (!options.dumpPath.empty()) {
+                dumpImage(options.dumpPath, pixels, options.width, options.height);
+            }
+            // zones du profiler (vide si compile sans TETRIS_PROFILER)
+            if (!options.tracePath.empty()) {
+                if (Profiler::writeChromeTrace(options.tracePath.c_str())) {
+                    std::cout << "trace:      " << options.tracePath << std::endl;
+                } else {
+                    std::cout << "Profiler disabled or trace not writable: " << options.tracePath << std::endl;
+                }
+            }
+        }
+
+        glDeleteRenderbuffers(1, &colorBuffer);
+        glDeleteRenderbuffers(1, &depthBuffer);
+        glDeleteFramebuffers(1, &fbo);
+    }
+
+    destroyContext(ctx);
+    return result;
+}
@@ -0,0 +1,38 @@
+#ifndef BLOCKMESH_H
+#define BLOCKMESH_H
+
+#include "CubeResources.h"
+#include <vector>
+#include <glm/glm.hpp>
+
+// sommet d'un mesh de blocs deja place dans le monde
+// edgeCoord: position dans la face en unites de case, pour dessiner les contours
+struct BlockVertex {
+    glm::vec3 position;
+    glm::vec3 normal;
+    glm::vec2 edgeCoord;
+    glm::vec3 color;
+};
+
+// mesh de triangles en coordonnees monde, dessine en un seul draw call
+class BlockMesh {
+public:
+    BlockMesh();
+    ~BlockMesh();
+
+    BlockMesh(const BlockMesh&) = delete;
+    BlockMesh& operator=(const BlockMesh&) = delete;
+
+    void upload(const std::vector<BlockVertex>& vertices, GLenum usage = GL_DYNAMIC_DRAW);
+    void draw() const;
+
+    int getVertexCount() const { return vertexCount; }
+
+private:
+    const CubeResources& resources;
+
+    unsigned int VAO, VBO;
+    int vertexCount;
+};
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "PieceShapes.h"
+#include <array>
+#include <cstdint>
+
+// terrain logique: un masque d'occupation par ligne plus la couleur de chaque case
+// le rendu est derive de ces donnees
+//
+// chaque ligne est stockee elargie: les colonnes 0..WIDTH-1 sont decalees de WALL_BITS
+// et tous les autres bits sont a 1 (murs). Sous le terrain il y a FLOOR_ROWS lignes
+// pleines (sol), au dessus SKY_ROWS lignes vides entre les murs.
+// un test de collision est donc juste quelques AND, sans verifier les bords
+class Board {
+public:
+    static constexpr int WIDTH = 10;
+    static constexpr int HEIGHT = 15;
+
+    using Row = uint16_t;
+    static constexpr Row FULL_ROW = static_cast<Row>((1u << WIDTH) - 1);
+
+    using WideRow = uint32_t;
+    static constexpr int WALL_BITS = 4;
+    static constexpr WideRow WALLS = ~(static_cast<WideRow>(FULL_ROW) << WALL_BITS);
+    static constexpr WideRow SOLID = ~static_cast<WideRow>(0);
+
+    // un bit par ligne du terrain (bit y = ligne y)
+    using RowMask = uint32_t;
+
+    // contenu d'une case: 0 = vide, sinon 0x01RRGGBB
+    using Cell = uint32_t;
+    static constexpr Cell EMPTY = 0;
+
+    static Cell makeCell(float r, float g, float b);
+
+    Board();
+
+    void clear();
+
+    Row getRow(int y) const { return static_cast<Row>((wideRows[y + FLOOR_ROWS] >> WALL_BITS) & FULL_ROW); }
+    bool isLineFull(int y) const { return wideRows[y + FLOOR_ROWS] == SOLID; }
+    bool isOccupied(int x, int y) const { return (getRow(y) >> x) & 1u; }
+
+    // masque de piece pose avec son coin bas gauche en (x, y)
+    // tout ce qui sort du terrain touche un mur ou le sol
+    bool collides(const PieceShapes::RowMasks& mask, int x, int y) const;
+
+    Cell getCell(int x, int y) const { return cells[y * WIDTH + x]; }
+    void setCell(int x, int y, Cell cell);
+
+    void clearRow(int y);
+    void copyRow(int from, int to);
+
+    // enleve toutes les lignes pleines en une passe: chaque ligne restante
+    // descend une seule fois a sa place finale. Renvoie les lignes enlevees
+    // (indices d'avant la compaction)
+    RowMask clearFullRows();
+
+    // meme masque et memes couleurs sur la ligne y
+    bool sameRow(const Board& other, int y) const;
+
+private:
+    static constexpr int FLOOR_ROWS = PieceShapes::BLOCK_COUNT;
+    static constexpr int SKY_ROWS = PieceShapes::BLOCK_COUNT;
+    static constexpr int WIDE_ROW_COUNT = FLOOR_ROWS + HEIGHT + SKY_ROWS;
+
+    std::array<WideRow, WIDE_ROW_COUNT> wideRows;
+    std::array<Cell, WIDTH * HEIGHT> cells;
+};
+
+inline bool Board::collides(const PieceShapes::RowMasks& mask, int x, int y) const {
+    int shift = x + WALL_BITS;
+    int index = y + FLOOR_ROWS;
+
+    // plus loin que les bits de garde: forcement dans un mur ou sous le sol
+    if (shift < 0 || shift > 32 - PieceShapes::BLOCK_COUNT || index < 0) return true;
+
+    WideRow hit = 0;
+    for (int i = 0; i < PieceShapes::BLOCK_COUNT; i++) {
+        // au dessus des lignes gardees il n'y a que les murs
+        WideRow row = index + i < WIDE_ROW_COUNT ? wideRows[index + i] : WALLS;
+        hit |= row & (static_cast<WideRow>(mask[i]) << shift);
+    }
+    return hit != 0;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef BOARDRENDERER_H
+#define BOARDRENDERER_H
+
+#include "CubeResources.h"
+#include "StreamBuffer.h"
+#include <vector>
+#include <glm/glm.hpp>
+
+// dessine tous les cubes du plateau en instancie, faces et contours en un seul draw call
+class BoardRenderer {
+public:
+    BoardRenderer();
+    ~BoardRenderer();
+
+    BoardRenderer(const BoardRenderer&) = delete;
+    BoardRenderer& operator=(const BoardRenderer&) = delete;
+
+    void begin();
+    void addCube(const glm::vec3& position, const glm::vec3& color);
+    void draw(StreamBuffer& stream);
+
+private:
+    struct Instance {
+        glm::vec3 position;
+        glm::vec3 color;
+    };
+
+    const CubeResources& resources;
+    std::vector<Instance> instances;
+
+    unsigned int VAO;
+    unsigned int shaderProgram;
+
+    static const char* vertexShaderSource;
+};
+
+#endif
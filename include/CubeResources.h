@@ -0,0 +1,42 @@
+#ifndef CUBERESOURCES_H
+#define CUBERESOURCES_H
+
+#include <glad/glad.h>
+
+// mesh et shaders partages par tous les cubes
+// cree au premier acquire(), detruit quand le dernier utilisateur fait release()
+class CubeResources {
+public:
+    static const CubeResources& acquire();
+    static void release();
+
+    static unsigned int compileProgram(const char* vertexSource, const char* fragmentSource);
+
+    // fragment shader eclaire qui lit la couleur dans la varying CubeColor
+    // et dessine le contour a partir de la varying EdgeCoord
+    static const char* litFragmentShaderSource;
+
+    // sommet du cube: position, normale, coordonnees dans la face
+    static const int VERTEX_STRIDE = 8 * sizeof(float);
+
+    // mesh du cube, lu par les VAO de chaque renderer
+    unsigned int VBO, EBO;
+
+    unsigned int meshShaderProgram;
+
+private:
+    CubeResources() = default;
+
+    void create();
+    void destroy();
+
+    static CubeResources instance;
+    static int refCount;
+
+    static const float vertices[];
+    static const unsigned int indices[];
+
+    static const char* meshVertexShaderSource;
+};
+
+#endif
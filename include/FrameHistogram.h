@@ -0,0 +1,45 @@
+#ifndef FRAMEHISTOGRAM_H
+#define FRAMEHISTOGRAM_H
+
+#include <array>
+#include <cstdint>
+
+// histogramme de durees a la HDR histogram: compteurs log-lineaires en microsecondes
+// 64 sous-buckets par puissance de 2, soit moins de 1.6% d'erreur sur les percentiles
+// de 1 us a ~67 s, taille fixe: record() est O(1) et n'alloue rien
+class FrameHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 6;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    // au dela de 2^MAX_BITS us la valeur est comptee dans le dernier bucket (max reste exact)
+    static constexpr int MAX_BITS = 26;
+    static constexpr int BUCKET_COUNT = (MAX_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    FrameHistogram();
+
+    void record(double seconds);
+    void reset();
+
+    uint64_t getCount() const { return count; }
+    // percentile 0..100 en millisecondes (borne haute du bucket), 0 si vide
+    double getPercentile(double percentile) const;
+    double getMax() const { return maxMicros / 1000.0; }
+    double getMean() const;
+
+    // valeurs au dessus du seuil (en ms), calcule a l'enregistrement
+    uint64_t getOverBudget() const { return overBudget; }
+    void setBudget(double ms);
+
+private:
+    static int bucketIndex(uint64_t micros);
+    static uint64_t bucketUpperBound(int index);
+
+    std::array<uint64_t, BUCKET_COUNT> buckets;
+    uint64_t count;
+    uint64_t totalMicros;
+    uint64_t maxMicros;
+    uint64_t budgetMicros;
+    uint64_t overBudget;
+};
+
+#endif
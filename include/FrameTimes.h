@@ -0,0 +1,47 @@
+#ifndef FRAMETIMES_H
+#define FRAMETIMES_H
+
+#include "FrameHistogram.h"
+#include <array>
+#include <string>
+
+// durees suivies par la boucle du jeu
+enum class FrameTimer {
+    FRAME,      // une image dessinee: ticks + rendu + swap (l'attente d'evenements n'est pas comptee)
+    UPDATE,     // ticks de simulation et entrees
+    RENDER,     // soumission du rendu
+    SWAP,       // glfwSwapBuffers (attente vsync comprise)
+    // execution GPU de chaque passe de rendu (RenderStats), meme ordre que RenderPass
+    GPU_WALLS,
+    GPU_STACK,
+    GPU_PIECE
+};
+
+// un histogramme par duree, rapport p50/p99/p99.9/max et images au dessus du budget
+// le saccade se juge sur la queue de distribution, pas sur la moyenne
+class FrameTimes {
+public:
+    static constexpr int TIMER_COUNT = 7;
+
+    explicit FrameTimes(double budgetMs = 1000.0 / 60.0);
+
+    void record(FrameTimer timer, double seconds) { histograms[static_cast<int>(timer)].record(seconds); }
+    const FrameHistogram& get(FrameTimer timer) const { return histograms[static_cast<int>(timer)]; }
+
+    void setBudget(double ms);
+    double getBudget() const { return budgetMs; }
+    void reset();
+
+    static const char* getTimerName(FrameTimer timer);
+
+    void printReport() const;
+    // une ligne par duree: timer,count,mean_ms,p50_ms,p99_ms,p999_ms,max_ms,over_budget
+    bool writeCsv(const std::string& path) const;
+    bool writeJson(const std::string& path) const;
+
+private:
+    std::array<FrameHistogram, TIMER_COUNT> histograms;
+    double budgetMs;
+};
+
+#endif
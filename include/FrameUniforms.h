@@ -0,0 +1,38 @@
+#ifndef FRAMEUNIFORMS_H
+#define FRAMEUNIFORMS_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// donnees constantes pendant une frame (camera, lumiere) dans un uniform buffer
+// ecrit une fois par frame, lu par tous les shaders via le bloc FrameData
+class FrameUniforms {
+public:
+    static const unsigned int BINDING_POINT = 0;
+    static const char* blockSource;
+
+    FrameUniforms();
+    ~FrameUniforms();
+
+    FrameUniforms(const FrameUniforms&) = delete;
+    FrameUniforms& operator=(const FrameUniforms&) = delete;
+
+    void update(const glm::mat4& view, const glm::mat4& projection,
+                const glm::vec3& lightPos, const glm::vec3& lightColor, const glm::vec3& viewPos);
+
+    static void bindProgram(unsigned int program);
+
+private:
+    // layout std140: les vec3 sont alignes sur 16 octets
+    struct Data {
+        glm::mat4 view;
+        glm::mat4 projection;
+        glm::vec4 lightPos;
+        glm::vec4 lightColor;
+        glm::vec4 viewPos;
+    };
+
+    unsigned int UBO;
+};
+
+#endif
@@ -2,10 +2,13 @@
 #define GAMEFIELD_H
 
 #include "Piece.h"
-#include "Cube.h"
+#include "Board.h"
+#include "PieceBag.h"
 #include <vector>
-#include <glm/glm.hpp>
-#include <random>
+#include <string>
+#include <optional>
+#include <array>
+#include <cstdint>
 
 enum class GameState {
     WAITING_TO_START,
@@ -13,54 +16,102 @@ enum class GameState {
     GAME_OVER
 };
 
+// regles du jeu, sans aucune dependance au rendu
+// le dessin passe par GameRenderer qui lit l'etat en const
 class GameField {
 public:
-    static const int FIELD_WIDTH = 10;
-    static const int FIELD_HEIGHT = 15;
+    static constexpr int FIELD_WIDTH = Board::WIDTH;
+    static constexpr int FIELD_HEIGHT = Board::HEIGHT;
 
+    // la simulation avance par pas fixes, independamment du nombre d'images par seconde
+    static constexpr int TICKS_PER_SECOND = 60;
+    static constexpr double TICK_SECONDS = 1.0 / TICKS_PER_SECOND;
+    static constexpr int DEFAULT_GRAVITY_TICKS = TICKS_PER_SECOND;
+
+    // graine tiree de l'heure: une partie differente a chaque lancement
     GameField();
-    ~GameField();
+    // meme graine + memes entrees = meme partie (replay, benchmarks, self-play)
+    explicit GameField(uint64_t seed);
 
-    void render();
+    // un pas de simulation; la gravite appelle update() tous les gravityTicks pas
+    // sans horloge: un bot ou un benchmark peut l'appeler aussi vite qu'il veut
+    void tick();
+    // une ligne de chute
     void update();
     void moveCurrentPiece(int dx, int dy);
+    // +1 horaire, -1 anti-horaire, avec les kicks SRS si la place est prise
+    void rotateCurrentPiece(int direction);
     void dropCurrentPiece();
     void startGame();
+    // nouvelle partie avec une graine tiree de la precedente (loguee, rejouable avec --seed)
     void restartGame();
+    void restartGame(uint64_t seed);
+    uint64_t getSeed() const { return seed; }
+    
+    void setGravityTicks(int ticks);
+    int getGravityTicks() const { return gravityTicks; }
+    int getTicksUntilGravity() const { return gravityTicks - gravityCounter; }
+    
+    // etat scripte (benchmarks, tests de rendu)
+    // rows de haut en bas: '.' vide, I T S Z J L = bloc de la couleur de ce type, autre = gris
+    void loadBoard(const std::vector<std::string>& rows);
+    void placePiece(PieceType type, int x, int y);
+    // piece avec sa rotation, telle quelle
+    void placePiece(const Piece& piece);
     
     bool isGameOver() const { return gameState == GameState::GAME_OVER; }
     GameState getGameState() const { return gameState; }
+    int getScore() const { return score; }
+    int getLinesCleared() const { return linesCleared; }
+    // lignes enlevees par le dernier lock (bit y = ligne y avant compaction), 0 si aucune
+    Board::RowMask getLastClearedRows() const { return lastClearedRows; }
+    
+    const Board& getBoard() const { return board; }
+    // nullptr entre deux pieces et apres le game over
+    const Piece* getCurrentPiece() const { return currentPiece ? &*currentPiece : nullptr; }
+    // la piece au debut du tick courant, pour interpoler le rendu
+    // nullptr si elle vient d'apparaitre (rien a interpoler)
+    const Piece* getPreviousPiece() const { return previousPiece ? &*previousPiece : nullptr; }
+    // la piece a glisse depuis le debut du tick (meme orientation, autre position)
+    bool isPieceMoving() const;
+    // y ou la piece courante se poserait en tombant (hard drop, apercu)
+    int getLandingY() const;
+    // la piece tient a cette position sans toucher murs, sol ni blocs (bots, benchmarks)
+    bool isValidPosition(const Piece& piece) const;
+    
+    // incremente a chaque changement visible, pour ne redessiner que si besoin
+    unsigned int getGeneration() const { return generation; }
 
 private:
-    void initializeWalls();
     void spawnNewPiece();
-    bool isValidPosition(const std::vector<glm::vec2>& positions);
     void lockCurrentPiece();
-    void checkAndClearLines();
-    bool isLineFull(int line);
-    void clearLine(int line);
-    void dropLinesAbove(int line);
+    Board::RowMask checkAndClearLines();
+    int findLandingY(const Piece& piece) const;
+    void updateColumnHeights();
     void clearField();
     
     
     // Game state
-    std::vector<std::vector<Cube*>> field;
-    std::vector<Cube*> walls;
-    Piece* currentPiece;
+    Board board;
+    // hauteur de chaque colonne (1 + plus haute case pleine, 0 si vide)
+    // mise a jour au lock et au clear de lignes
+    std::array<int, FIELD_WIDTH> columnHeights;
+    // stockee par valeur: spawn et lock n'allouent rien
+    std::optional<Piece> currentPiece;
+    std::optional<Piece> previousPiece;
     GameState gameState;
     int score;
     int linesCleared;
+    Board::RowMask lastClearedRows;
+    unsigned int generation;
     
-    // Camera and projection
-    glm::mat4 view;
-    glm::mat4 projection;
+    // gravite en ticks
+    int gravityTicks;
+    int gravityCounter;
     
     // Random generator
-    std::mt19937 rng;
-    std::uniform_int_distribution<int> pieceDist;
-    
-    // Indicator cubes
-    std::vector<Cube*> indicatorCubes;
+    uint64_t seed;
+    PieceBag bag;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef GAMERENDERER_H
+#define GAMERENDERER_H
+
+#include "GameField.h"
+#include "Board.h"
+#include "BoardRenderer.h"
+#include "BlockMesh.h"
+#include "FrameUniforms.h"
+#include "PassTimer.h"
+#include "StackMesh.h"
+#include "StreamBuffer.h"
+#include <glm/glm.hpp>
+
+// adaptateur entre les regles (GameField) et OpenGL
+// lit l'etat du jeu sans le modifier, a creer apres le contexte GL
+class GameRenderer {
+public:
+    static const glm::vec3 WALL_COLOR;
+
+    GameRenderer();
+
+    // alpha = fraction du tick en cours ecoulee (0..1): la piece qui tombe est dessinee
+    // entre sa position du debut du tick et sa position actuelle
+    void render(const GameField& game, float alpha = 1.0f);
+
+private:
+    void initializeWalls();
+    void syncStack(const GameField& game);
+
+    // Camera and projection
+    glm::mat4 view;
+    glm::mat4 projection;
+    FrameUniforms frameUniforms;
+    // temps CPU et GPU de chaque passe, lus dans RenderStats
+    PassTimer passTimer;
+
+    // Rendu instancie de la piece qui tombe
+    BoardRenderer boardRenderer;
+    StreamBuffer instanceStream;
+
+    // Mesh des blocs poses, regenere seulement sur les lignes modifiees
+    // drawnBoard = terrain tel qu'il etait au dernier rebuild
+    StackMesh stackMesh;
+    Board drawnBoard;
+    unsigned int drawnGeneration;
+
+    // Murs precalcules en un seul mesh statique
+    BlockMesh wallMesh;
+    int wallMeshWidth, wallMeshHeight;
+};
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef GRIDMESHER_H
+#define GRIDMESHER_H
+
+#include "BlockMesh.h"
+#include "Board.h"
+#include <vector>
+#include <glm/glm.hpp>
+
+// genere les faces visibles d'une grille de cubes unitaires poses dans le plan z = 0
+// - les faces collees a un cube voisin sont supprimees
+// - les faces coplanaires de meme couleur sont fusionnees (greedy meshing)
+// cellAt(x, y) retourne le Board::Cell de la case (Board::EMPTY si vide)
+// seules les cases de [xBegin, xEnd) x [yBegin, yEnd) produisent des faces
+namespace GridMesher {
+
+inline void appendQuad(std::vector<BlockVertex>& out,
+                       const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec3& d,
+                       const glm::vec3& normal, const glm::vec3& color) {
+    // taille du quad en cases, les contours sont dessines a chaque bord de case
+    float width = glm::length(b - a);
+    float height = glm::length(c - b);
+    glm::vec2 ea(0.0f, 0.0f), eb(width, 0.0f), ec(width, height), ed(0.0f, height);
+
+    // deux triangles, sens anti-horaire vu de l'exterieur
+    out.push_back({a, normal, ea, color});
+    out.push_back({b, normal, eb, color});
+    out.push_back({c, normal, ec, color});
+    out.push_back({c, normal, ec, color});
+    out.push_back({d, normal, ed, color});
+    out.push_back({a, normal, ea, color});
+}
+
+inline glm::vec3 cellColor(Board::Cell cell) {
+    return glm::vec3(((cell >> 16) & 0xFF) / 255.0f, ((cell >> 8) & 0xFF) / 255.0f, (cell & 0xFF) / 255.0f);
+}
+
+template <typename CellFn>
+void meshRows(int xBegin, int xEnd, int yBegin, int yEnd, CellFn cellAt, std::vector<BlockVertex>& out) {
+    const int width = xEnd - xBegin;
+    const int height = yEnd - yBegin;
+    if (width <= 0 || height <= 0) return;
+
+    // faces avant et arriere: toujours visibles, fusionnees en rectangles
+    std::vector<char> used(width * height, 0);
+    auto isUsed = [&](int x, int y) -> char& { return used[(y - yBegin) * width + (x - xBegin)]; };
+
+    for (int y = yBegin; y < yEnd; y++) {
+        for (int x = xBegin; x < xEnd; x++) {
+            Board::Cell cell = cellAt(x, y);
+            if (cell == Board::EMPTY || isUsed(x, y)) continue;
+
+            // etend d'abord en largeur, puis en hauteur tant que la ligne entiere correspond
+            int x1 = x + 1;
+            while (x1 < xEnd && !isUsed(x1, y) && cellAt(x1, y) == cell) x1++;
+
+            int y1 = y + 1;
+            while (y1 < yEnd) {
+                bool rowMatches = true;
+                for (int k = x; k < x1 && rowMatches; k++) {
+                    rowMatches = !isUsed(k, y1) && cellAt(k, y1) == cell;
+                }
+                if (!rowMatches) break;
+                y1++;
+            }
+
+            for (int j = y; j < y1; j++) {
+                for (int k = x; k < x1; k++) {
+                    isUsed(k, j) = 1;
+                }
+            }
+
+            glm::vec3 color = cellColor(cell);
+            float left = x - 0.5f, right = x1 - 0.5f;
+            float bottom = y - 0.5f, top = y1 - 0.5f;
+            appendQuad(out, {left, bottom, 0.5f}, {right, bottom, 0.5f}, {right, top, 0.5f}, {left, top, 0.5f},
+                       {0.0f, 0.0f, 1.0f}, color);
+            appendQuad(out, {right, bottom, -0.5f}, {left, bottom, -0.5f}, {left, top, -0.5f}, {right, top, -0.5f},
+                       {0.0f, 0.0f, -1.0f}, color);
+        }
+    }
+
+    // faces du haut et du bas: segments le long de x
+    for (int y = yBegin; y < yEnd; y++) {
+        for (int dir = -1; dir <= 1; dir += 2) {
+            int x = xBegin;
+            while (x < xEnd) {
+                Board::Cell cell = cellAt(x, y);
+                if (cell == Board::EMPTY || cellAt(x, y + dir) != Board::EMPTY) {
+                    x++;
+                    continue;
+                }
+
+                int x1 = x + 1;
+                while (x1 < xEnd && cellAt(x1, y) == cell && cellAt(x1, y + dir) == Board::EMPTY) x1++;
+
+                glm::vec3 color = cellColor(cell);
+
+                float left = x - 0.5f, right = x1 - 0.5f;
+                float face = y + 0.5f * dir;
+                if (dir > 0) {
+                    appendQuad(out, {left, face, 0.5f}, {right, face, 0.5f}, {right, face, -0.5f}, {left, face, -0.5f},
+                               {0.0f, 1.0f, 0.0f}, color);
+                } else {
+                    appendQuad(out, {left, face, -0.5f}, {right, face, -0.5f}, {right, face, 0.5f}, {left, face, 0.5f},
+                               {0.0f, -1.0f, 0.0f}, color);
+                }
+                x = x1;
+            }
+        }
+    }
+
+    // faces gauche et droite: segments le long de y
+    for (int x = xBegin; x < xEnd; x++) {
+        for (int dir = -1; dir <= 1; dir += 2) {
+            int y = yBegin;
+            while (y < yEnd) {
+                Board::Cell cell = cellAt(x, y);
+                if (cell == Board::EMPTY || cellAt(x + dir, y) != Board::EMPTY) {
+                    y++;
+                    continue;
+                }
+
+                int y1 = y + 1;
+                while (y1 < yEnd && cellAt(x, y1) == cell && cellAt(x + dir, y1) == Board::EMPTY) y1++;
+
+                glm::vec3 color = cellColor(cell);
+
+                float bottom = y - 0.5f, top = y1 - 0.5f;
+                float face = x + 0.5f * dir;
+                if (dir > 0) {
+                    appendQuad(out, {face, bottom, 0.5f}, {face, bottom, -0.5f}, {face, top, -0.5f}, {face, top, 0.5f},
+                               {1.0f, 0.0f, 0.0f}, color);
+                } else {
+                    appendQuad(out, {face, bottom, -0.5f}, {face, bottom, 0.5f}, {face, top, 0.5f}, {face, top, -0.5f},
+                               {-1.0f, 0.0f, 0.0f}, color);
+                }
+                y = y1;
+            }
+        }
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef INPUTCONTROLLER_H
+#define INPUTCONTROLLER_H
+
+#include "GameField.h"
+#include <array>
+
+enum class InputAction {
+    MOVE_LEFT,
+    MOVE_RIGHT,
+    ROTATE_CW,
+    ROTATE_CCW,
+    HARD_DROP
+};
+
+struct InputEvent {
+    InputAction action;
+    bool pressed;       // false = touche relachee
+    double time;        // secondes, meme horloge que celle passee a process()
+};
+
+// entrees du joueur: les evenements clavier sont horodates et mis en file,
+// la simulation les consomme a chaque tick
+// l'auto-shift (DAS: delai avant repetition, ARR: intervalle entre repetitions)
+// est calcule ici a partir des horodatages, sans dependre de la repetition de l'OS
+class InputController {
+public:
+    static constexpr int QUEUE_SIZE = 64;
+    static constexpr double DEFAULT_DAS = 10 * GameField::TICK_SECONDS;
+    static constexpr double DEFAULT_ARR = 2 * GameField::TICK_SECONDS;
+
+    InputController();
+
+    // arr <= 0: la piece va directement contre le mur
+    void setAutoShift(double das, double arr);
+    double getDas() const { return das; }
+    double getArr() const { return arr; }
+
+    // false si la file est pleine (l'evenement est perdu)
+    bool push(const InputEvent& event);
+
+    // applique au jeu les evenements et les repetitions jusqu'a time (fin du tick)
+    void process(GameField& game, double time);
+
+    // oublie les touches tenues et les evenements en attente (restart)
+    void reset();
+
+    // il reste des evenements a consommer ou une direction tenue: la boucle ne doit pas dormir plus d'un tick
+    bool isBusy() const { return count > 0 || shiftDirection != 0; }
+
+private:
+    void apply(GameField& game, const InputEvent& event);
+    void autoShift(GameField& game, double time);
+
+    // file circulaire: pas d'allocation dans le callback clavier
+    std::array<InputEvent, QUEUE_SIZE> queue;
+    int head, count;
+
+    double das, arr;
+
+    bool leftHeld, rightHeld;
+    int shiftDirection;     // -1, 0 ou 1: la derniere direction pressee gagne
+    double nextShift;       // moment de la prochaine repetition
+};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+enum class LogLevel {
+    DEBUG,
+    INFO,
+    WARNING,
+    ERROR
+};
+
+// champ cle=valeur d'un message; la cle doit etre une chaine litterale,
+// un texte est copie dans le message au moment du log
+struct LogField {
+    enum class Type { INT, UINT, FLOAT, TEXT };
+
+    LogField() : key(""), type(Type::INT), intValue(0) {}
+    LogField(const char* key, int value) : key(key), type(Type::INT), intValue(value) {}
+    LogField(const char* key, long value) : key(key), type(Type::INT), intValue(value) {}
+    LogField(const char* key, long long value) : key(key), type(Type::INT), intValue(value) {}
+    LogField(const char* key, unsigned int value) : key(key), type(Type::UINT), uintValue(value) {}
+    LogField(const char* key, unsigned long value) : key(key), type(Type::UINT), uintValue(value) {}
+    LogField(const char* key, unsigned long long value) : key(key), type(Type::UINT), uintValue(value) {}
+    LogField(const char* key, double value) : key(key), type(Type::FLOAT), floatValue(value) {}
+    LogField(const char* key, const char* value) : key(key), type(Type::TEXT), textValue(value) {}
+    LogField(const char* key, const std::string& value) : key(key), type(Type::TEXT), textValue(value.c_str()) {}
+
+    const char* key;
+    Type type;
+    union {
+        int64_t intValue;
+        uint64_t uintValue;
+        double floatValue;
+        const char* textValue;
+    };
+};
+
+// logger asynchrone: le thread qui logue copie le message dans un buffer circulaire
+// sans verrou ni allocation ni I/O, un thread de fond l'ecrit sur la sortie standard
+// si le buffer est plein le message est perdu (et compte) plutot que de bloquer le jeu
+//
+// Log::info("lines cleared", {{"count", 2}, {"score", 300}});
+// -> [    12.345] INFO    lines cleared count=2 score=300
+class Log {
+public:
+    // messages en attente avant d'en perdre
+    static constexpr int RING_SIZE = 512;
+    static constexpr int MAX_FIELDS = 6;
+    // place pour les textes copies d'un message, tronques au dela
+    static constexpr int TEXT_SIZE = 256;
+
+    static void setLevel(LogLevel level);
+    static LogLevel getLevel();
+    static bool isEnabled(LogLevel level) { return level >= getLevel(); }
+
+    // message: chaine litterale (lue plus tard par le thread de fond)
+    static void write(LogLevel level, const char* message, std::initializer_list<LogField> fields = {});
+
+    static void debug(const char* message, std::initializer_list<LogField> fields = {}) { write(LogLevel::DEBUG, message, fields); }
+    static void info(const char* message, std::initializer_list<LogField> fields = {}) { write(LogLevel::INFO, message, fields); }
+    static void warning(const char* message, std::initializer_list<LogField> fields = {}) { write(LogLevel::WARNING, message, fields); }
+    static void error(const char* message, std::initializer_list<LogField> fields = {}) { write(LogLevel::ERROR, message, fields); }
+
+    // attend que tout ce qui a ete logue soit ecrit (avant d'ecrire soi-meme sur la sortie)
+    static void flush();
+    // messages perdus parce que le buffer etait plein
+    static uint64_t getDropped();
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef PASSTIMER_H
+#define PASSTIMER_H
+
+#include "RenderStats.h"
+#include <glad/glad.h>
+#include <chrono>
+
+// temps de chaque passe de rendu, rapportes dans RenderStats
+// - CPU: duree de soumission des commandes, connue tout de suite
+// - GPU: requetes GL_TIME_ELAPSED, une serie par frame sur FRAME_COUNT frames;
+//   une serie n'est relue que quand elle revient a son tour, sans jamais attendre le GPU
+// les passes ne s'imbriquent pas: une seule requete GL_TIME_ELAPSED active a la fois
+class PassTimer {
+public:
+    static const int FRAME_COUNT = 3;
+
+    PassTimer();
+    ~PassTimer();
+
+    PassTimer(const PassTimer&) = delete;
+    PassTimer& operator=(const PassTimer&) = delete;
+
+    // relit la serie la plus ancienne et la reutilise pour cette frame
+    void beginFrame();
+    void begin(RenderPass pass);
+    void end();
+
+private:
+    void collect(int frame);
+
+    unsigned int queries[FRAME_COUNT][RenderStats::PASS_COUNT];
+    // requete emise et pas encore relue
+    bool pending[FRAME_COUNT][RenderStats::PASS_COUNT];
+    int currentFrame;
+
+    int activePass;
+    std::chrono::steady_clock::time_point cpuStart;
+};
+
+#endif
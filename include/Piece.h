@@ -1,36 +1,46 @@
 #ifndef PIECE_H
 #define PIECE_H
 
-#include "Cube.h"
-#include <vector>
-#include <glm/glm.hpp>
-
-enum class PieceType {
-    I = 0, T = 1, S = 2, Z = 3, J = 4, L = 5
-};
+#include "Board.h"
+#include "PieceShapes.h"
 
+// piece qui tombe: simple valeur (type, orientation, position, couleur), copiable et sans allocation
+// la forme est lue dans les tables de PieceShapes
 class Piece {
 public:
-    Piece(PieceType type, float x, float y);
-    ~Piece();
+    static constexpr int BLOCK_COUNT = PieceShapes::BLOCK_COUNT;
+    using Blocks = PieceShapes::Blocks;
+
+    // couleur du type (getTypeColor)
+    Piece(PieceType type, int x, int y);
+    Piece(PieceType type, int x, int y, Board::Cell color);
     
-    void render(const glm::mat4& view, const glm::mat4& projection);
-    void move(float dx, float dy);
-    void setPosition(float x, float y);
+    void move(int dx, int dy);
+    void setPosition(int x, int y);
+    // quart de tour sur place: +1 horaire, -1 anti-horaire (les kicks sont geres par GameField)
+    void rotate(int direction);
     
-    std::vector<glm::vec2> getBlockPositions() const;
-    glm::vec3 getColor() const { return color; }
+    PieceType getType() const { return type; }
+    int getRotation() const { return rotation; }
+    int getX() const { return x; }
+    int getY() const { return y; }
+    Board::Cell getColor() const { return color; }
     
-private:
-    void initializePiece(PieceType type);
-    void updateCubePositions();
-    glm::vec3 getRandomColor();
+    // positions des blocs sur le terrain, renvoyees par valeur (pas de tas)
+    Blocks getBlockPositions() const;
+    // forme relative au pivot de la piece
+    const Blocks& getShape() const { return PieceShapes::SHAPES[static_cast<int>(type)][rotation]; }
+    // masque de collision de l'orientation courante
+    const PieceShapes::Mask& getMask() const { return PieceShapes::MASKS[static_cast<int>(type)][rotation]; }
+    
+    // couleur fixe par type: une partie rejouee avec la meme graine a les memes couleurs
+    static Board::Cell getTypeColor(PieceType type);
     
+private:
     PieceType type;
-    float x, y;
-    std::vector<glm::vec2> shape;
-    std::vector<Cube*> cubes;
-    glm::vec3 color;
+    int rotation;
+    int x, y;
+    Board::Cell color;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,26 @@
+#ifndef PIECEBAG_H
+#define PIECEBAG_H
+
+#include "PieceShapes.h"
+#include "Random.h"
+#include <array>
+#include <cstdint>
+
+// tirage des pieces par sacs: chaque sac contient chaque type une fois, dans un ordre melange
+// une meme graine donne toujours la meme suite de pieces
+class PieceBag {
+public:
+    explicit PieceBag(uint64_t seed);
+
+    void setSeed(uint64_t seed);
+    PieceType next();
+
+private:
+    void refill();
+
+    Random random;
+    std::array<PieceType, PieceShapes::TYPE_COUNT> bag;
+    int index;
+};
+
+#endif
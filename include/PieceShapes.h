@@ -0,0 +1,167 @@
+#ifndef PIECESHAPES_H
+#define PIECESHAPES_H
+
+#include <array>
+#include <cstdint>
+
+enum class PieceType {
+    I = 0, T = 1, S = 2, Z = 3, J = 4, L = 5
+};
+
+// position d'un bloc en cases du terrain
+struct BlockPos {
+    int x, y;
+};
+
+// tables des pieces calculees a la compilation: formes, masques de collision
+// et kicks de rotation pour chaque type et chaque orientation (quart de tour horaire)
+namespace PieceShapes {
+
+constexpr int TYPE_COUNT = 6;
+constexpr int ROTATION_COUNT = 4;
+constexpr int BLOCK_COUNT = 4;
+
+using Blocks = std::array<BlockPos, BLOCK_COUNT>;
+
+// une ligne de bits par rangee de la piece, en partant du bas
+// bit 0 = colonne la plus a gauche de la piece
+using RowMasks = std::array<uint8_t, BLOCK_COUNT>;
+
+struct Mask {
+    RowMasks rows;
+    int minX, minY;   // coin bas gauche de la boite englobante, relatif au pivot
+    int width;
+    // par colonne de la boite: rangee du bloc le plus bas (pour trouver ou la piece se pose)
+    std::array<int, BLOCK_COUNT> bottoms;
+};
+
+// formes de base (orientation 0), dans l'ordre de PieceType
+constexpr std::array<Blocks, TYPE_COUNT> BASE_SHAPES = {{
+    {{{-2, 0}, {-1, 0}, {0, 0}, {1, 0}}},   // I: barre droite
+    {{{0, 0}, {-1, 0}, {1, 0}, {0, 1}}},    // T: piece en T
+    {{{0, 0}, {0, 1}, {1, 1}, {1, 2}}},     // S: piece en S
+    {{{1, 0}, {1, 1}, {0, 1}, {0, 2}}},     // Z: piece en Z
+    {{{0, 0}, {0, 1}, {0, -1}, {-1, -1}}},  // J: piece en J
+    {{{0, 0}, {0, 1}, {0, -1}, {1, -1}}}    // L: piece en L
+}};
+
+constexpr Blocks rotateClockwise(Blocks blocks) {
+    for (auto& block : blocks) {
+        int x = block.x;
+        block.x = block.y;
+        block.y = -x;
+    }
+    return blocks;
+}
+
+constexpr std::array<std::array<Blocks, ROTATION_COUNT>, TYPE_COUNT> makeShapes() {
+    std::array<std::array<Blocks, ROTATION_COUNT>, TYPE_COUNT> shapes{};
+    for (int type = 0; type < TYPE_COUNT; type++) {
+        shapes[type][0] = BASE_SHAPES[type];
+        for (int rotation = 1; rotation < ROTATION_COUNT; rotation++) {
+            shapes[type][rotation] = rotateClockwise(shapes[type][rotation - 1]);
+        }
+    }
+    return shapes;
+}
+
+constexpr Mask makeMask(const Blocks& blocks) {
+    Mask mask{};
+    mask.minX = blocks[0].x;
+    mask.minY = blocks[0].y;
+    for (const auto& block : blocks) {
+        if (block.x < mask.minX) mask.minX = block.x;
+        if (block.y < mask.minY) mask.minY = block.y;
+    }
+    for (int column = 0; column < BLOCK_COUNT; column++) {
+        mask.bottoms[column] = BLOCK_COUNT;
+    }
+    for (const auto& block : blocks) {
+        int column = block.x - mask.minX;
+        int row = block.y - mask.minY;
+        mask.rows[row] |= static_cast<uint8_t>(1u << column);
+        if (row < mask.bottoms[column]) mask.bottoms[column] = row;
+        if (column + 1 > mask.width) mask.width = column + 1;
+    }
+    return mask;
+}
+
+constexpr std::array<std::array<Mask, ROTATION_COUNT>, TYPE_COUNT> makeMasks() {
+    constexpr auto shapes = makeShapes();
+    std::array<std::array<Mask, ROTATION_COUNT>, TYPE_COUNT> masks{};
+    for (int type = 0; type < TYPE_COUNT; type++) {
+        for (int rotation = 0; rotation < ROTATION_COUNT; rotation++) {
+            masks[type][rotation] = makeMask(shapes[type][rotation]);
+        }
+    }
+    return masks;
+}
+
+inline constexpr auto SHAPES = makeShapes();
+inline constexpr auto MASKS = makeMasks();
+
+// rotation facon SRS: on essaie la piece tournee a KICK_COUNT decalages, le premier qui passe gagne
+// les decalages se deduisent des offsets de chaque orientation:
+// kick(from -> to) = offsets[from] - offsets[to], ramene pour que le premier test soit (0, 0)
+// (nos pieces tournent autour de leur pivot, le premier test est donc la rotation sur place)
+constexpr int KICK_COUNT = 5;
+using Kicks = std::array<BlockPos, KICK_COUNT>;
+using KickOffsets = std::array<Kicks, ROTATION_COUNT>;
+
+constexpr KickOffsets JLSTZ_OFFSETS = {{
+    {{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}}},
+    {{{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}}},
+    {{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}}},
+    {{{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}}}
+}};
+
+constexpr KickOffsets I_OFFSETS = {{
+    {{{0, 0}, {-1, 0}, {2, 0}, {-1, 0}, {2, 0}}},
+    {{{-1, 0}, {0, 0}, {0, 0}, {0, 1}, {0, -2}}},
+    {{{-1, 1}, {1, 1}, {-2, 1}, {1, 0}, {-2, 0}}},
+    {{{0, 1}, {0, 1}, {0, 1}, {0, -1}, {0, 2}}}
+}};
+
+constexpr Kicks makeKicks(const KickOffsets& offsets, int from, int to) {
+    Kicks kicks{};
+    int baseX = offsets[from][0].x - offsets[to][0].x;
+    int baseY = offsets[from][0].y - offsets[to][0].y;
+    for (int i = 0; i < KICK_COUNT; i++) {
+        kicks[i].x = offsets[from][i].x - offsets[to][i].x - baseX;
+        kicks[i].y = offsets[from][i].y - offsets[to][i].y - baseY;
+    }
+    return kicks;
+}
+
+// KICKS[type][from][0] = quart de tour horaire, KICKS[type][from][1] = anti-horaire
+constexpr std::array<std::array<std::array<Kicks, 2>, ROTATION_COUNT>, TYPE_COUNT> makeKickTable() {
+    std::array<std::array<std::array<Kicks, 2>, ROTATION_COUNT>, TYPE_COUNT> table{};
+    for (int type = 0; type < TYPE_COUNT; type++) {
+        const KickOffsets& offsets = type == static_cast<int>(PieceType::I) ? I_OFFSETS : JLSTZ_OFFSETS;
+        for (int from = 0; from < ROTATION_COUNT; from++) {
+            table[type][from][0] = makeKicks(offsets, from, (from + 1) % ROTATION_COUNT);
+            table[type][from][1] = makeKicks(offsets, from, (from + ROTATION_COUNT - 1) % ROTATION_COUNT);
+        }
+    }
+    return table;
+}
+
+inline constexpr auto KICKS = makeKickTable();
+
+// direction: +1 horaire, -1 anti-horaire
+constexpr const Kicks& getKicks(PieceType type, int from, int direction) {
+    return KICKS[static_cast<int>(type)][from][direction > 0 ? 0 : 1];
+}
+
+// verifs a la compilation
+static_assert(MASKS[0][0].rows[0] == 0x0F && MASKS[0][0].minX == -2, "I couche = 4 bits sur une ligne");
+static_assert(MASKS[0][1].rows[0] == 1 && MASKS[0][1].rows[3] == 1, "I debout = 1 bit sur 4 lignes");
+static_assert(MASKS[1][0].rows[0] == 0x07 && MASKS[1][0].rows[1] == 0x02, "T pointe vers le haut");
+static_assert(getKicks(PieceType::T, 0, 1)[1].x == -1 && getKicks(PieceType::T, 0, 1)[2].y == 1, "SRS JLSTZ 0->R");
+static_assert(getKicks(PieceType::I, 0, 1)[1].x == -2 && getKicks(PieceType::I, 0, 1)[4].y == 2, "SRS I 0->R");
+static_assert(getKicks(PieceType::I, 3, 1)[1].x == 1 && getKicks(PieceType::I, 3, 1)[3].y == -2, "SRS I L->0");
+static_assert(MASKS[2][0].width == 2 && MASKS[2][0].bottoms[1] == 1, "S: la colonne de droite commence une rangee plus haut");
+
+}
+
+#endif
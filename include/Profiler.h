@@ -0,0 +1,49 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+
+// profiler CPU par zones: PROFILE_ZONE("nom") mesure le bloc courant
+// chaque thread ecrit dans son propre buffer circulaire (les plus vieilles zones sont ecrasees)
+// et writeChromeTrace() sort le tout au format trace JSON de Chrome (chrome://tracing, Perfetto)
+//
+// compile seulement avec TETRIS_PROFILER (option CMake du meme nom),
+// sinon les macros ne generent rien et writeChromeTrace() ne fait rien
+class Profiler {
+public:
+    // zones gardees par thread avant d'ecraser les plus anciennes
+    static constexpr int RING_SIZE = 1 << 16;
+
+    static bool isEnabled();
+
+    // ecrit toutes les zones enregistrees; false si desactive ou si le fichier ne s'ouvre pas
+    static bool writeChromeTrace(const char* path);
+
+    // nanosecondes depuis le lancement
+    static uint64_t now();
+    static void record(const char* name, uint64_t start, uint64_t end);
+
+    class Zone {
+    public:
+        explicit Zone(const char* name) : name(name), start(now()) {}
+        ~Zone() { record(name, start, now()); }
+
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        const char* name;
+        uint64_t start;
+    };
+};
+
+#ifdef TETRIS_PROFILER
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+// le nom doit rester valide jusqu'au dump: une chaine litterale
+#define PROFILE_ZONE(name) Profiler::Zone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// generateur PCG32: 16 octets d'etat, rapide, meme suite pour une meme graine sur toutes les plateformes
+// (std::mt19937 fait 2.5 Ko et les distributions de la std ne sont pas portables)
+class Random {
+public:
+    explicit Random(uint64_t seed = 0) { setSeed(seed); }
+
+    void setSeed(uint64_t seed) {
+        state = 0;
+        next();
+        state += seed;
+        next();
+    }
+
+    uint32_t next() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ull + INCREMENT;
+        uint32_t xorShifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rotation = static_cast<uint32_t>(old >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+    }
+
+    // entier uniforme dans [0, bound), sans biais
+    uint32_t nextBelow(uint32_t bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        for (;;) {
+            uint32_t value = next();
+            if (value >= threshold) return value % bound;
+        }
+    }
+
+private:
+    static constexpr uint64_t INCREMENT = 1442695040888963407ull;
+
+    uint64_t state;
+};
+
+#endif
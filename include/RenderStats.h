@@ -0,0 +1,44 @@
+#ifndef RENDERSTATS_H
+#define RENDERSTATS_H
+
+// passes de rendu mesurees separement (le contour est dessine dans la meme passe que les faces)
+enum class RenderPass {
+    WALLS,
+    STACK,
+    PIECE
+};
+
+// compteurs de rendu remis a zero a chaque frame (draw calls, sommets)
+// et temps par passe: soumission CPU de la frame courante, execution GPU de la derniere
+// frame dont les resultats sont revenus (quelques frames de retard, voir PassTimer)
+class RenderStats {
+public:
+    static constexpr int PASS_COUNT = 3;
+
+    static void beginFrame();
+    static void countDraw(long vertices);
+
+    static int getDrawCalls() { return drawCalls; }
+    static long getVertices() { return vertices; }
+
+    static void setPassCpuTime(RenderPass pass, double ms) { passCpuTimes[static_cast<int>(pass)] = ms; }
+    static void setPassGpuTime(RenderPass pass, double ms) {
+        passGpuTimes[static_cast<int>(pass)] = ms;
+        passGpuFresh[static_cast<int>(pass)] = true;
+    }
+    static double getPassCpuTime(RenderPass pass) { return passCpuTimes[static_cast<int>(pass)]; }
+    // -1 tant qu'aucun resultat GPU n'est revenu
+    static double getPassGpuTime(RenderPass pass) { return passGpuTimes[static_cast<int>(pass)]; }
+    // chaque resultat GPU une seule fois, au moment ou il revient (pour un histogramme)
+    static bool takePassGpuTime(RenderPass pass, double& ms);
+    static const char* getPassName(RenderPass pass);
+
+private:
+    static int drawCalls;
+    static long vertices;
+    static double passCpuTimes[PASS_COUNT];
+    static double passGpuTimes[PASS_COUNT];
+    static bool passGpuFresh[PASS_COUNT];
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef STACKMESH_H
+#define STACKMESH_H
+
+#include "BlockMesh.h"
+#include "GridMesher.h"
+#include <vector>
+#include <glm/glm.hpp>
+
+// mesh des blocs poses: uniquement les faces visibles, fusionnees par couleur
+// la geometrie est gardee par ligne et seules les lignes modifiees sont regenerees
+class StackMesh {
+public:
+    StackMesh(int width, int height);
+
+    void markRowsDirty(int firstRow, int lastRow);
+    void markAllDirty();
+
+    // cellAt(x, y) -> Board::Cell de la case
+    template <typename CellFn>
+    void rebuild(CellFn cellAt);
+
+    void draw() const;
+
+private:
+    int width, height;
+    bool dirty;
+    std::vector<bool> dirtyRows;
+    std::vector<std::vector<BlockVertex>> rowVertices;
+    std::vector<BlockVertex> vertices;
+    BlockMesh mesh;
+};
+
+template <typename CellFn>
+void StackMesh::rebuild(CellFn cellAt) {
+    if (!dirty) return;
+
+    // hors du terrain tout est vide, les faces contre les murs restent visibles
+    auto cellInField = [&](int x, int y) -> Board::Cell {
+        if (x < 0 || x >= width || y < 0 || y >= height) return Board::EMPTY;
+        return cellAt(x, y);
+    };
+
+    // regenere seulement les lignes touchees
+    for (int y = 0; y < height; y++) {
+        if (!dirtyRows[y]) continue;
+        rowVertices[y].clear();
+        GridMesher::meshRows(0, width, y, y + 1, cellInField, rowVertices[y]);
+        dirtyRows[y] = false;
+    }
+
+    vertices.clear();
+    for (const auto& row : rowVertices) {
+        vertices.insert(vertices.end(), row.begin(), row.end());
+    }
+    mesh.upload(vertices);
+    dirty = false;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef STREAMBUFFER_H
+#define STREAMBUFFER_H
+
+#include <glad/glad.h>
+#include <cstddef>
+
+// buffer circulaire pour les donnees qui changent a chaque frame (instances, etc.)
+// trois regions: le CPU ecrit dans l'une pendant que le GPU lit les deux autres,
+// chaque region est protegee par une fence posee a la fin de sa frame
+// - GL 4.4 / ARB_buffer_storage: mapping persistant et coherent, juste un memcpy
+// - sinon (GL 3.3): glMapBufferRange non synchronise sur la plage ecrite
+class StreamBuffer {
+public:
+    static const int REGION_COUNT = 3;
+
+    explicit StreamBuffer(size_t regionSize);
+    ~StreamBuffer();
+
+    StreamBuffer(const StreamBuffer&) = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    void beginFrame();
+    void endFrame();
+
+    // copie les donnees dans la region courante et retourne leur offset dans le buffer
+    // si la region est trop petite le buffer est recree plus grand: ecrire puis dessiner
+    // tout de suite, les draws deja emis gardent l'ancien buffer jusqu'a leur fin
+    size_t write(const void* data, size_t size, size_t alignment = 16);
+
+    unsigned int getBuffer() const { return buffer; }
+    bool isPersistent() const { return persistent; }
+
+private:
+    void create();
+    void destroy();
+    void grow(size_t minRegionSize);
+    void waitForRegion(int region);
+
+    static bool hasBufferStorage();
+
+    unsigned int buffer;
+    size_t regionSize;
+    int currentRegion;
+    size_t regionOffset;
+
+    bool persistent;
+    char* mappedData;
+    GLsync fences[REGION_COUNT];
+};
+
+#endif
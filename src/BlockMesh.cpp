@@ -0,0 +1,45 @@
+#include "BlockMesh.h"
+#include "RenderStats.h"
+#include <cstddef>
+
+BlockMesh::BlockMesh() : resources(CubeResources::acquire()), vertexCount(0) {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(BlockVertex), (void*)offsetof(BlockVertex, position));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(BlockVertex), (void*)offsetof(BlockVertex, normal));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(BlockVertex), (void*)offsetof(BlockVertex, edgeCoord));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(BlockVertex), (void*)offsetof(BlockVertex, color));
+    glEnableVertexAttribArray(3);
+
+    glBindVertexArray(0);
+}
+
+BlockMesh::~BlockMesh() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    CubeResources::release();
+}
+
+void BlockMesh::upload(const std::vector<BlockVertex>& vertices, GLenum usage) {
+    vertexCount = static_cast<int>(vertices.size());
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(BlockVertex), vertices.data(), usage);
+}
+
+void BlockMesh::draw() const {
+    if (vertexCount == 0) return;
+
+    glUseProgram(resources.meshShaderProgram);
+    glBindVertexArray(VAO);
+    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+    RenderStats::countDraw(vertexCount);
+    glBindVertexArray(0);
+}
@@ -0,0 +1,69 @@
+#include "Board.h"
+#include <algorithm>
+
+static_assert(Board::WIDTH + 2 * Board::WALL_BITS <= 32, "une ligne et ses murs doivent tenir dans un WideRow");
+static_assert(Board::HEIGHT <= 32, "une ligne par bit dans un RowMask");
+
+Board::Cell Board::makeCell(float r, float g, float b) {
+    auto channel = [](float v) {
+        return static_cast<Cell>(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f);
+    };
+    return 0x01000000u | (channel(r) << 16) | (channel(g) << 8) | channel(b);
+}
+
+Board::Board() {
+    clear();
+}
+
+void Board::clear() {
+    std::fill(wideRows.begin(), wideRows.begin() + FLOOR_ROWS, SOLID);
+    std::fill(wideRows.begin() + FLOOR_ROWS, wideRows.end(), WALLS);
+    cells.fill(EMPTY);
+}
+
+void Board::setCell(int x, int y, Cell cell) {
+    cells[y * WIDTH + x] = cell;
+    WideRow bit = static_cast<WideRow>(1u) << (x + WALL_BITS);
+    if (cell != EMPTY) {
+        wideRows[y + FLOOR_ROWS] |= bit;
+    } else {
+        wideRows[y + FLOOR_ROWS] &= ~bit;
+    }
+}
+
+void Board::clearRow(int y) {
+    wideRows[y + FLOOR_ROWS] = WALLS;
+    std::fill(cells.begin() + y * WIDTH, cells.begin() + (y + 1) * WIDTH, EMPTY);
+}
+
+void Board::copyRow(int from, int to) {
+    wideRows[to + FLOOR_ROWS] = wideRows[from + FLOOR_ROWS];
+    std::copy(cells.begin() + from * WIDTH, cells.begin() + (from + 1) * WIDTH, cells.begin() + to * WIDTH);
+}
+
+Board::RowMask Board::clearFullRows() {
+    RowMask cleared = 0;
+    int target = 0;
+    
+    for (int y = 0; y < HEIGHT; y++) {
+        if (isLineFull(y)) {
+            cleared |= static_cast<RowMask>(1u) << y;
+            continue;
+        }
+        if (target != y) {
+            copyRow(y, target);
+        }
+        target++;
+    }
+    
+    // le haut du terrain se vide d'autant de lignes qu'on en a enleve
+    for (int y = target; y < HEIGHT; y++) {
+        clearRow(y);
+    }
+    return cleared;
+}
+
+bool Board::sameRow(const Board& other, int y) const {
+    return wideRows[y + FLOOR_ROWS] == other.wideRows[y + FLOOR_ROWS] &&
+           std::equal(cells.begin() + y * WIDTH, cells.begin() + (y + 1) * WIDTH, other.cells.begin() + y * WIDTH);
+}
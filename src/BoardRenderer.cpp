@@ -0,0 +1,84 @@
+#include "BoardRenderer.h"
+#include "RenderStats.h"
+#include <cstddef>
+
+const char* BoardRenderer::vertexShaderSource = R"(
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aEdgeCoord;
+layout (location = 3) in vec3 aOffset;
+layout (location = 4) in vec3 aColor;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec3 CubeColor;
+out vec2 EdgeCoord;
+
+void main() {
+    // le modele n'est qu'une translation, la normale ne change pas
+    FragPos = aPos + aOffset;
+    Normal = aNormal;
+    CubeColor = aColor;
+    EdgeCoord = aEdgeCoord;
+
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
+)";
+
+BoardRenderer::BoardRenderer() : resources(CubeResources::acquire()) {
+    // mesh partage + attributs par instance
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, resources.VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, resources.EBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, CubeResources::VERTEX_STRIDE, (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, CubeResources::VERTEX_STRIDE, (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, CubeResources::VERTEX_STRIDE, (void*)(6 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+
+    // position et couleur avancent une fois par cube,
+    // le buffer et l'offset sont donnes a chaque frame par le StreamBuffer
+    glEnableVertexAttribArray(3);
+    glVertexAttribDivisor(3, 1);
+    glEnableVertexAttribArray(4);
+    glVertexAttribDivisor(4, 1);
+
+    glBindVertexArray(0);
+
+    shaderProgram = CubeResources::compileProgram(vertexShaderSource, CubeResources::litFragmentShaderSource);
+}
+
+BoardRenderer::~BoardRenderer() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteProgram(shaderProgram);
+    CubeResources::release();
+}
+
+void BoardRenderer::begin() {
+    instances.clear();
+}
+
+void BoardRenderer::addCube(const glm::vec3& position, const glm::vec3& color) {
+    instances.push_back({position, color});
+}
+
+void BoardRenderer::draw(StreamBuffer& stream) {
+    if (instances.empty()) return;
+
+    // copie les instances dans la region de la frame, sans attendre le GPU
+    size_t offset = stream.write(instances.data(), instances.size() * sizeof(Instance));
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, stream.getBuffer());
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, position)));
+    glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offset + offsetof(Instance, color)));
+
+    // faces et contours en une seule passe, camera et lumiere viennent du bloc FrameData
+    glUseProgram(shaderProgram);
+    glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0, static_cast<GLsizei>(instances.size()));
+    RenderStats::countDraw(36 * static_cast<long>(instances.size()));
+    glBindVertexArray(0);
+}
@@ -0,0 +1,201 @@
+#include "CubeResources.h"
+#include "FrameUniforms.h"
+#include "Log.h"
+
+CubeResources CubeResources::instance;
+int CubeResources::refCount = 0;
+
+// donnees des vertices: position, normale, coordonnees dans la face (pour les contours)
+const float CubeResources::vertices[] = {
+    // Face avant
+    -0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 0.0f, // 0
+     0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 0.0f, // 1
+     0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f, 1.0f, // 2
+    -0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f, 1.0f, // 3
+
+    // Face arriere
+    -0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 0.0f, // 4
+     0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 0.0f, // 5
+     0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f, 1.0f, // 6
+    -0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f, 1.0f, // 7
+
+    // Face gauche
+    -0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 0.0f, // 8
+    -0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 0.0f, // 9
+    -0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f, 1.0f, // 10
+    -0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f, 1.0f, // 11
+
+    // Face droite
+     0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 0.0f, // 12
+     0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 0.0f, // 13
+     0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f, 1.0f, // 14
+     0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f, // 15
+
+    // Face du bas
+    -0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 0.0f, // 16
+     0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 0.0f, // 17
+     0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f, 1.0f, // 18
+    -0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f, 1.0f, // 19
+
+    // Face du haut
+    -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 0.0f, // 20
+     0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 0.0f, // 21
+     0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f, 1.0f, // 22
+    -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f  // 23
+};
+
+// indices pour dessiner les triangles
+const unsigned int CubeResources::indices[] = {
+    // Face avant
+    0, 1, 2, 2, 3, 0,
+    // Face arriere
+    4, 5, 6, 6, 7, 4,
+    // Face gauche
+    8, 9, 10, 10, 11, 8,
+    // Face droite
+    12, 13, 14, 14, 15, 12,
+    // Face du bas
+    16, 17, 18, 18, 19, 16,
+    // Face du haut
+    20, 21, 22, 22, 23, 20
+};
+
+// eclairage commun a tous les cubes, avec le contour dessine dans la meme passe
+// EdgeCoord est en unites de case: les bords de case tombent sur les valeurs entieres
+const char* CubeResources::litFragmentShaderSource = R"(
+out vec4 FragColor;
+
+in vec3 FragPos;
+in vec3 Normal;
+in vec3 CubeColor;
+in vec2 EdgeCoord;
+
+const float edgeWidthPixels = 1.0;
+
+void main() {
+    // Ambient
+    float ambientStrength = 0.4;
+    vec3 ambient = ambientStrength * lightColor;
+    
+    // Diffuse
+    vec3 norm = normalize(Normal);
+    vec3 lightDir = normalize(lightPos - FragPos);
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor;
+    
+    // Specular
+    float specularStrength = 0.1;
+    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 16);
+    vec3 specular = specularStrength * spec * lightColor;
+    
+    vec3 result = (ambient + diffuse + specular) * CubeColor;
+    
+    // distance au bord de case le plus proche, convertie en pixels
+    vec2 cell = fract(EdgeCoord);
+    vec2 distToEdge = min(cell, 1.0 - cell) / max(fwidth(EdgeCoord), vec2(1e-6));
+    float edge = 1.0 - smoothstep(edgeWidthPixels - 0.5, edgeWidthPixels + 0.5, min(distToEdge.x, distToEdge.y));
+    
+    // contour plus fonce
+    FragColor = vec4(mix(result, CubeColor * 0.3, edge), 1.0);
+}
+)";
+
+const char* CubeResources::meshVertexShaderSource = R"(
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aEdgeCoord;
+layout (location = 3) in vec3 aColor;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec3 CubeColor;
+out vec2 EdgeCoord;
+
+void main() {
+    // sommets deja en coordonnees monde
+    FragPos = aPos;
+    Normal = aNormal;
+    CubeColor = aColor;
+    EdgeCoord = aEdgeCoord;
+
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
+)";
+
+const CubeResources& CubeResources::acquire() {
+    // le premier cube cree les objets GL, les suivants les reutilisent
+    if (refCount == 0) {
+        instance.create();
+    }
+    refCount++;
+    return instance;
+}
+
+void CubeResources::release() {
+    if (refCount == 0) return;
+
+    refCount--;
+    if (refCount == 0) {
+        instance.destroy();
+    }
+}
+
+unsigned int CubeResources::compileProgram(const char* vertexSource, const char* fragmentSource) {
+    // chaque shader commence par la version et le bloc FrameData commun
+    const char* vertexSources[] = {"#version 330 core\n", FrameUniforms::blockSource, vertexSource};
+    const char* fragmentSources[] = {"#version 330 core\n", FrameUniforms::blockSource, fragmentSource};
+
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 3, vertexSources, NULL);
+    glCompileShader(vertexShader);
+
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 3, fragmentSources, NULL);
+    glCompileShader(fragmentShader);
+
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        char infoLog[512];
+        glGetProgramInfoLog(program, 512, NULL, infoLog);
+        Log::error("failed to link shader program", {{"log", infoLog}});
+    }
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    FrameUniforms::bindProgram(program);
+
+    return program;
+}
+
+void CubeResources::create() {
+    // mesh des faces; les attributs sont decrits par le VAO de chaque renderer
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // l'element buffer se lie a un VAO: pas de VAO ici, on le remplit via GL_ARRAY_BUFFER
+    glBindBuffer(GL_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // shader des meshes de blocs, compile une seule fois pour tout le process
+    meshShaderProgram = compileProgram(meshVertexShaderSource, litFragmentShaderSource);
+}
+
+void CubeResources::destroy() {
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(1, &EBO);
+    glDeleteProgram(meshShaderProgram);
+}
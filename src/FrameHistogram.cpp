@@ -0,0 +1,80 @@
+#include "FrameHistogram.h"
+#include <algorithm>
+#include <cmath>
+
+FrameHistogram::FrameHistogram() : budgetMicros(UINT64_MAX) {
+    reset();
+}
+
+void FrameHistogram::reset() {
+    buckets.fill(0);
+    count = 0;
+    totalMicros = 0;
+    maxMicros = 0;
+    overBudget = 0;
+}
+
+void FrameHistogram::setBudget(double ms) {
+    budgetMicros = static_cast<uint64_t>(std::max(0.0, ms) * 1000.0);
+}
+
+int FrameHistogram::bucketIndex(uint64_t micros) {
+    // les SUB_BUCKETS*2 premieres valeurs ont chacune leur bucket,
+    // ensuite chaque puissance de 2 est coupee en SUB_BUCKETS parts egales
+    if (micros < 2 * SUB_BUCKETS) {
+        return static_cast<int>(micros);
+    }
+    
+    int highestBit = 63;
+    while (((micros >> highestBit) & 1u) == 0) highestBit--;
+    
+    int shift = highestBit - SUB_BUCKET_BITS;
+    int index = shift * SUB_BUCKETS + static_cast<int>(micros >> shift);
+    return std::min(index, BUCKET_COUNT - 1);
+}
+
+uint64_t FrameHistogram::bucketUpperBound(int index) {
+    if (index < 2 * SUB_BUCKETS) {
+        return static_cast<uint64_t>(index);
+    }
+    
+    // inverse de bucketIndex: index = shift * SUB_BUCKETS + mantisse, mantisse dans [SUB_BUCKETS, 2 * SUB_BUCKETS)
+    int shift = index / SUB_BUCKETS - 1;
+    uint64_t mantissa = static_cast<uint64_t>(index - shift * SUB_BUCKETS);
+    return ((mantissa + 1) << shift) - 1;
+}
+
+void FrameHistogram::record(double seconds) {
+    uint64_t micros = static_cast<uint64_t>(std::max(0.0, seconds) * 1.0e6 + 0.5);
+    
+    buckets[bucketIndex(micros)]++;
+    count++;
+    totalMicros += micros;
+    maxMicros = std::max(maxMicros, micros);
+    if (micros > budgetMicros) {
+        overBudget++;
+    }
+}
+
+double FrameHistogram::getPercentile(double percentile) const {
+    if (count == 0) return 0.0;
+    
+    // rang de la valeur cherchee (1 = la plus petite)
+    double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * count)));
+    
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            // jamais plus que le max reellement vu, ni moins pour le dernier bucket qui deborde
+            if (i == BUCKET_COUNT - 1) return getMax();
+            return std::min(bucketUpperBound(i), maxMicros) / 1000.0;
+        }
+    }
+    return getMax();
+}
+
+double FrameHistogram::getMean() const {
+    return count == 0 ? 0.0 : totalMicros / 1000.0 / count;
+}
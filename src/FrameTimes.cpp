@@ -0,0 +1,88 @@
+#include "FrameTimes.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+
+FrameTimes::FrameTimes(double budgetMs) {
+    setBudget(budgetMs);
+}
+
+void FrameTimes::setBudget(double ms) {
+    budgetMs = ms;
+    for (auto& histogram : histograms) {
+        histogram.setBudget(ms);
+    }
+}
+
+void FrameTimes::reset() {
+    for (auto& histogram : histograms) {
+        histogram.reset();
+    }
+}
+
+const char* FrameTimes::getTimerName(FrameTimer timer) {
+    switch (timer) {
+        case FrameTimer::FRAME: return "frame";
+        case FrameTimer::UPDATE: return "update";
+        case FrameTimer::RENDER: return "render";
+        case FrameTimer::SWAP: return "swap";
+        case FrameTimer::GPU_WALLS: return "gpu_walls";
+        case FrameTimer::GPU_STACK: return "gpu_stack";
+        case FrameTimer::GPU_PIECE: return "gpu_piece";
+    }
+    return "";
+}
+
+void FrameTimes::printReport() const {
+    std::cout << "Frame times (ms, budget " << budgetMs << "):" << std::endl;
+    for (int i = 0; i < TIMER_COUNT; i++) {
+        const FrameHistogram& histogram = histograms[i];
+        std::cout << "  " << std::left << std::setw(9) << getTimerName(static_cast<FrameTimer>(i)) << std::right
+                  << " n " << histogram.getCount()
+                  << " | p50 " << histogram.getPercentile(50.0)
+                  << " | p99 " << histogram.getPercentile(99.0)
+                  << " | p99.9 " << histogram.getPercentile(99.9)
+                  << " | max " << histogram.getMax()
+                  << " | over budget " << histogram.getOverBudget() << std::endl;
+    }
+}
+
+bool FrameTimes::writeCsv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) return false;
+    
+    file << "timer,count,mean_ms,p50_ms,p99_ms,p999_ms,max_ms,over_budget\n";
+    for (int i = 0; i < TIMER_COUNT; i++) {
+        const FrameHistogram& histogram = histograms[i];
+        file << getTimerName(static_cast<FrameTimer>(i)) << ','
+             << histogram.getCount() << ','
+             << histogram.getMean() << ','
+             << histogram.getPercentile(50.0) << ','
+             << histogram.getPercentile(99.0) << ','
+             << histogram.getPercentile(99.9) << ','
+             << histogram.getMax() << ','
+             << histogram.getOverBudget() << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+bool FrameTimes::writeJson(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) return false;
+    
+    file << "{\n  \"budget_ms\": " << budgetMs << ",\n  \"timers\": {";
+    for (int i = 0; i < TIMER_COUNT; i++) {
+        const FrameHistogram& histogram = histograms[i];
+        file << (i == 0 ? "\n" : ",\n")
+             << "    \"" << getTimerName(static_cast<FrameTimer>(i)) << "\": {"
+             << "\"count\": " << histogram.getCount()
+             << ", \"mean_ms\": " << histogram.getMean()
+             << ", \"p50_ms\": " << histogram.getPercentile(50.0)
+             << ", \"p99_ms\": " << histogram.getPercentile(99.0)
+             << ", \"p999_ms\": " << histogram.getPercentile(99.9)
+             << ", \"max_ms\": " << histogram.getMax()
+             << ", \"over_budget\": " << histogram.getOverBudget() << "}";
+    }
+    file << "\n  }\n}\n";
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,43 @@
+#include "FrameUniforms.h"
+
+const char* FrameUniforms::blockSource = R"(
+layout (std140) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    vec3 lightPos;
+    vec3 lightColor;
+    vec3 viewPos;
+};
+)";
+
+FrameUniforms::FrameUniforms() {
+    glGenBuffers(1, &UBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(Data), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+FrameUniforms::~FrameUniforms() {
+    glDeleteBuffers(1, &UBO);
+}
+
+void FrameUniforms::update(const glm::mat4& view, const glm::mat4& projection,
+                           const glm::vec3& lightPos, const glm::vec3& lightColor, const glm::vec3& viewPos) {
+    Data data;
+    data.view = view;
+    data.projection = projection;
+    data.lightPos = glm::vec4(lightPos, 0.0f);
+    data.lightColor = glm::vec4(lightColor, 0.0f);
+    data.viewPos = glm::vec4(viewPos, 0.0f);
+
+    // un seul upload pour toute la frame
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING_POINT, UBO);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Data), &data);
+}
+
+void FrameUniforms::bindProgram(unsigned int program) {
+    unsigned int blockIndex = glGetUniformBlockIndex(program, "FrameData");
+    if (blockIndex != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program, blockIndex, BINDING_POINT);
+    }
+}
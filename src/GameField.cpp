@@ -1,99 +1,52 @@
 #include "GameField.h"
-#include <iostream>
-#include <glm/gtc/matrix_transform.hpp>
+#include "Profiler.h"
+#include "Log.h"
+#include "Random.h"
 #include <ctime>
+#include <algorithm>
+#include <bitset>
 
-GameField::GameField() : currentPiece(nullptr), gameState(GameState::PLAYING),
-                         score(0), linesCleared(0), rng(static_cast<unsigned int>(std::time(0))), pieceDist(0, 5) {
-    // init le terrain vide
-    field.resize(FIELD_HEIGHT);
-    for (int y = 0; y < FIELD_HEIGHT; y++) {
-        field[y].resize(FIELD_WIDTH, nullptr);
-    }
-    
-    initializeWalls();
-    
-    // camera qui regarde le terrain
-    view = glm::lookAt(
-        glm::vec3(20.0f, 25.0f, 70.0f),
-        glm::vec3(4.5f, 7.5f, 0.0f),
-        glm::vec3(0.0f, 1.0f, 0.0f)
-    );
-    
-    projection = glm::perspective(
-        glm::radians(15.0f),
-        1200.0f / 900.0f, 
-        0.1f, 
-        100.0f
-    );
-    
+GameField::GameField() : GameField(static_cast<uint64_t>(std::time(0))) {
+}
+
+GameField::GameField(uint64_t seed) : gameState(GameState::PLAYING),
+                                      score(0), linesCleared(0), lastClearedRows(0), generation(0),
+                                      gravityTicks(DEFAULT_GRAVITY_TICKS), gravityCounter(0),
+                                      seed(seed), bag(seed) {
+    columnHeights.fill(0);
     spawnNewPiece();
-    std::cout << "\n=== TETRIS 3D - GAME STARTED ===" << std::endl;
+    Log::info("game started", {{"seed", seed}});
 }
 
-GameField::~GameField() {
-    clearField();
+void GameField::tick() {
+    // etat de depart du tick: le rendu interpole entre celui-ci et le suivant
+    previousPiece = currentPiece;
     
-    // nettoie tout
-    for (Cube* wall : walls) {
-        delete wall;
-    }
+    if (gameState != GameState::PLAYING) return;
     
-    for (Cube* cube : indicatorCubes) {
-        delete cube;
+    gravityCounter++;
+    if (gravityCounter >= gravityTicks) {
+        gravityCounter = 0;
+        update();
     }
-    
-    delete currentPiece;
 }
 
-void GameField::render() {
-    // dessine les murs
-    for (Cube* wall : walls) {
-        wall->render(view, projection);
-    }
-    
-    // dessine les cubes poses
-    for (int y = 0; y < FIELD_HEIGHT; y++) {
-        for (int x = 0; x < FIELD_WIDTH; x++) {
-            if (field[y][x] != nullptr) {
-                field[y][x]->render(view, projection);
-            }
-        }
-    }
-    
-    // dessine la piece qui tombe
-    if (currentPiece != nullptr) {
-        currentPiece->render(view, projection);
-    }
+void GameField::setGravityTicks(int ticks) {
+    gravityTicks = std::max(ticks, 1);
+    gravityCounter = std::min(gravityCounter, gravityTicks - 1);
 }
 
-void GameField::clearField() {
-    // vide tout le terrain
-    for (int y = 0; y < FIELD_HEIGHT; y++) {
-        for (int x = 0; x < FIELD_WIDTH; x++) {
-            delete field[y][x];
-            field[y][x] = nullptr;
-        }
-    }
+bool GameField::isPieceMoving() const {
+    return currentPiece && previousPiece &&
+           currentPiece->getRotation() == previousPiece->getRotation() &&
+           (currentPiece->getX() != previousPiece->getX() || currentPiece->getY() != previousPiece->getY());
 }
 
-void GameField::initializeWalls() {
-    glm::vec3 wallColor(0.3f, 0.3f, 0.3f);
-    
-    // mur du bas
-    for (int x = -1; x <= FIELD_WIDTH; x++) {
-        walls.push_back(new Cube(static_cast<float>(x), -1.0f, 0.0f, wallColor));
-    }
-    
-    // mur de gauche
-    for (int y = 0; y < FIELD_HEIGHT + 2; y++) {
-        walls.push_back(new Cube(-1.0f, static_cast<float>(y), 0.0f, wallColor));
-    }
-    
-    // mur de droite
-    for (int y = 0; y < FIELD_HEIGHT + 2; y++) {
-        walls.push_back(new Cube(static_cast<float>(FIELD_WIDTH), static_cast<float>(y), 0.0f, wallColor));
-    }
+void GameField::clearField() {
+    // vide tout le terrain
+    board.clear();
+    columnHeights.fill(0);
+    generation++;
 }
 
 void GameField::startGame() {
@@ -102,142 +55,151 @@ void GameField::startGame() {
 }
 
 void GameField::restartGame() {
+    // nouvelle graine tiree de la precedente: la graine loguee rejoue cette partie,
+    // et une session lancee avec --seed reste reproductible restart compris
+    Random derive(seed);
+    uint64_t high = derive.next();
+    restartGame((high << 32) | derive.next());
+}
+
+void GameField::restartGame(uint64_t newSeed) {
+    // on repart du debut de la suite de pieces de cette graine
+    seed = newSeed;
+    bag.setSeed(seed);
+    
     // remet tout a zero
     clearField();
-    delete currentPiece;
-    currentPiece = nullptr;
+    currentPiece.reset();
+    previousPiece.reset();
     score = 0;
     linesCleared = 0;
+    lastClearedRows = 0;
+    gameState = GameState::PLAYING;
+    
+    spawnNewPiece();
+    Log::info("game restarted", {{"seed", seed}});
+}
+
+void GameField::loadBoard(const std::vector<std::string>& rows) {
+    clearField();
+    currentPiece.reset();
+    previousPiece.reset();
     gameState = GameState::PLAYING;
     
-    for (Cube* cube : indicatorCubes) {
-        delete cube;
+    const std::string pieceLetters = "ITSZJL";
+    int rowCount = static_cast<int>(rows.size());
+    
+    for (int i = 0; i < rowCount; i++) {
+        // la derniere ligne donnee est le fond du terrain
+        int y = rowCount - 1 - i;
+        if (y >= FIELD_HEIGHT) continue;
+        
+        int width = std::min(static_cast<int>(rows[i].size()), FIELD_WIDTH);
+        for (int x = 0; x < width; x++) {
+            char c = rows[i][x];
+            if (c == '.' || c == ' ') continue;
+            
+            size_t letter = pieceLetters.find(c);
+            Board::Cell cell = letter != std::string::npos
+                ? Piece::getTypeColor(static_cast<PieceType>(letter))
+                : Board::makeCell(0.5f, 0.5f, 0.5f);
+            board.setCell(x, y, cell);
+        }
     }
-    indicatorCubes.clear();
     
-    spawnNewPiece();
-    std::cout << "\n=== GAME RESTARTED ===" << std::endl;
+    updateColumnHeights();
+    generation++;
+}
+
+void GameField::placePiece(PieceType type, int x, int y) {
+    placePiece(Piece(type, x, y, Piece::getTypeColor(type)));
+}
+
+void GameField::placePiece(const Piece& piece) {
+    currentPiece = piece;
+    previousPiece.reset();
+    generation++;
 }
 
 void GameField::spawnNewPiece() {
     if (gameState != GameState::PLAYING) return;
     
-    // cree une piece aleatoire
-    PieceType type = static_cast<PieceType>(pieceDist(rng));
-    currentPiece = new Piece(type, 5.0f, FIELD_HEIGHT);
+    // nouvelle piece (ou game over): il faut redessiner
+    generation++;
+    
+    // piece suivante du sac, couleur fixee par son type
+    // elle apparait sans interpolation et a droit a un intervalle de gravite complet
+    currentPiece.emplace(bag.next(), 5, FIELD_HEIGHT);
+    previousPiece.reset();
+    gravityCounter = 0;
     
     // check si on peut la placer
-    if (!isValidPosition(currentPiece->getBlockPositions())) {
+    if (!isValidPosition(*currentPiece)) {
         gameState = GameState::GAME_OVER;
-        std::cout << "\n=== GAME OVER ===" << std::endl;
-        std::cout << "Final Score: " << score << std::endl;
-        std::cout << "Lines Cleared: " << linesCleared << std::endl;
-        std::cout << "Press any key to restart!" << std::endl;
+        Log::info("game over, press any key to restart", {{"score", score}, {"lines", linesCleared}});
         return;
     }
 }
 
-bool GameField::isValidPosition(const std::vector<glm::vec2>& positions) {
-    for (const auto& pos : positions) {
-        int x = static_cast<int>(pos.x);
-        int y = static_cast<int>(pos.y);
-        
-        // verifie les limites
-        if (x < 0 || x >= FIELD_WIDTH || y < 0) {
-            return false;
-        }
-        
-        // verifie collision avec pieces deja posees
-        if (y < FIELD_HEIGHT && field[y][x] != nullptr) {
-            return false;
-        }
-    }
-    return true;
+bool GameField::isValidPosition(const Piece& piece) const {
+    // masque precalcule de la piece contre les lignes du terrain, murs et sol compris
+    const PieceShapes::Mask& mask = piece.getMask();
+    return !board.collides(mask.rows, piece.getX() + mask.minX, piece.getY() + mask.minY);
 }
 
 void GameField::lockCurrentPiece() {
     if (!currentPiece) return;
+    PROFILE_ZONE("lock");
     
     // pose la piece sur le terrain
     auto positions = currentPiece->getBlockPositions();
-    auto color = currentPiece->getColor();
+    Board::Cell cell = currentPiece->getColor();
     
     for (const auto& pos : positions) {
-        int x = static_cast<int>(pos.x);
-        int y = static_cast<int>(pos.y);
+        int x = pos.x;
+        int y = pos.y;
         
         if (y >= 0 && y < FIELD_HEIGHT && x >= 0 && x < FIELD_WIDTH) {
-            field[y][x] = new Cube(static_cast<float>(x), static_cast<float>(y), 0.0f, color);
+            board.setCell(x, y, cell);
+            columnHeights[x] = std::max(columnHeights[x], y + 1);
         }
     }
     
-    delete currentPiece;
-    currentPiece = nullptr;
+    currentPiece.reset();
+    previousPiece.reset();
+    generation++;
     
     checkAndClearLines();
 }
 
-void GameField::checkAndClearLines() {
-    // cherche les lignes completes
-    for (int y = FIELD_HEIGHT - 1; y >= 0; y--) {
-        if (isLineFull(y)) {
-            clearLine(y);
-            dropLinesAbove(y);
-            linesCleared++;
-            score += 100;
-            y++; // recheck la meme ligne
-            
-            std::cout << "Line cleared! Score: " << score << " | Lines: " << linesCleared << std::endl;
-        }
-    }
-}
-
-bool GameField::isLineFull(int line) {
-    // check si la ligne est pleine
-    for (int x = 0; x < FIELD_WIDTH; x++) {
-        if (field[line][x] == nullptr) {
-            return false;
-        }
-    }
-    return true;
-}
-
-void GameField::clearLine(int line) {
-    // supprime tous les cubes de la ligne
-    for (int x = 0; x < FIELD_WIDTH; x++) {
-        if (field[line][x] != nullptr) {
-            delete field[line][x];
-            field[line][x] = nullptr;
-        }
-    }
-}
-
-void GameField::dropLinesAbove(int clearedLine) {
-    // fait descendre tout ce qui est au dessus
-    for (int y = clearedLine; y < FIELD_HEIGHT - 1; y++) {
-        for (int x = 0; x < FIELD_WIDTH; x++) {
-            field[y][x] = field[y + 1][x];
-            field[y + 1][x] = nullptr;
-            
-            // update la position visuelle
-            if (field[y][x] != nullptr) {
-                field[y][x]->setPosition(static_cast<float>(x), static_cast<float>(y), 0.0f);
-            }
-        }
-    }
+Board::RowMask GameField::checkAndClearLines() {
+    PROFILE_ZONE("clear lines");
+    // toutes les lignes completes partent en une seule passe
+    Board::RowMask cleared = board.clearFullRows();
+    lastClearedRows = cleared;
+    if (cleared == 0) return cleared;
+    
+    updateColumnHeights();
+    
+    int count = static_cast<int>(std::bitset<32>(cleared).count());
+    linesCleared += count;
+    score += 100 * count;
+    
+    // asynchrone: pas d'ecriture sur la sortie au moment du clear
+    Log::info("lines cleared", {{"count", count}, {"score", score}, {"lines", linesCleared}});
+    return cleared;
 }
 
 void GameField::update() {
     if (gameState != GameState::PLAYING || !currentPiece) return;
     
     // fait tomber la piece automatiquement
-    auto newPositions = currentPiece->getBlockPositions();
-    for (auto& pos : newPositions) {
-        pos.y -= 1;
-    }
+    Piece moved = *currentPiece;
+    moved.move(0, -1);
     
-    if (isValidPosition(newPositions)) {
-        currentPiece->move(0, -1);
+    if (isValidPosition(moved)) {
+        *currentPiece = moved;
+        generation++;
     } else {
         // piece touchee, on la pose
         lockCurrentPiece();
@@ -249,35 +211,88 @@ void GameField::moveCurrentPiece(int dx, int dy) {
     if (gameState != GameState::PLAYING || !currentPiece) return;
     
     // essaie de bouger la piece
-    auto newPositions = currentPiece->getBlockPositions();
-    for (auto& pos : newPositions) {
-        pos.x += dx;
-        pos.y += dy;
-    }
+    Piece moved = *currentPiece;
+    moved.move(dx, dy);
     
-    if (isValidPosition(newPositions)) {
-        currentPiece->move(dx, dy);
+    if (isValidPosition(moved)) {
+        *currentPiece = moved;
+        generation++;
     }
 }
 
-void GameField::dropCurrentPiece() {
+void GameField::rotateCurrentPiece(int direction) {
     if (gameState != GameState::PLAYING || !currentPiece) return;
     
-    // fait tomber d'un coup jusqu'en bas
-    bool canMoveDown = true;
-    while (canMoveDown) {
-        auto newPositions = currentPiece->getBlockPositions();
-        for (auto& pos : newPositions) {
-            pos.y -= 1;
-        }
+    Piece rotated = *currentPiece;
+    rotated.rotate(direction);
+    
+    // premier decalage de la table qui laisse la piece libre
+    for (const auto& kick : PieceShapes::getKicks(currentPiece->getType(), currentPiece->getRotation(), direction)) {
+        Piece kicked = rotated;
+        kicked.move(kick.x, kick.y);
         
-        if (isValidPosition(newPositions)) {
-            currentPiece->move(0, -1);
-        } else {
-            canMoveDown = false;
+        if (isValidPosition(kicked)) {
+            *currentPiece = kicked;
+            generation++;
+            return;
         }
     }
+}
+
+void GameField::dropCurrentPiece() {
+    if (gameState != GameState::PLAYING || !currentPiece) return;
+    
+    // fait tomber d'un coup jusqu'en bas
+    currentPiece->setPosition(currentPiece->getX(), findLandingY(*currentPiece));
     
     lockCurrentPiece();
     spawnNewPiece();
-}
\ No newline at end of file
+}
+
+int GameField::getLandingY() const {
+    return currentPiece ? findLandingY(*currentPiece) : 0;
+}
+
+int GameField::findLandingY(const Piece& piece) const {
+    const PieceShapes::Mask& mask = piece.getMask();
+    int left = piece.getX() + mask.minX;
+    int bottom = piece.getY() + mask.minY;
+    
+    // chaque colonne de la piece se pose sur le haut de sa colonne du terrain
+    // la piece s'arrete sur la plus haute
+    int landing = 0;
+    // colonnes hors du terrain (piece placee a la main): pas de hauteur a lire, la descente decide
+    bool aboveSurface = left >= 0 && left + mask.width <= FIELD_WIDTH;
+    for (int column = 0; column < mask.width && aboveSurface; column++) {
+        int height = columnHeights[left + column];
+        landing = std::max(landing, height - mask.bottoms[column]);
+        aboveSurface = aboveSurface && bottom + mask.bottoms[column] >= height;
+    }
+    if (aboveSurface) {
+        return landing - mask.minY;
+    }
+    
+    // piece glissee sous un surplomb: les hauteurs ne suffisent pas, on descend case par case
+    Piece moved = piece;
+    moved.move(0, -1);
+    while (isValidPosition(moved)) {
+        moved.move(0, -1);
+    }
+    return moved.getY() + 1;
+}
+
+void GameField::updateColumnHeights() {
+    // du haut vers le bas: la premiere case pleine de chaque colonne donne sa hauteur
+    columnHeights.fill(0);
+    Board::Row remaining = Board::FULL_ROW;
+    
+    for (int y = FIELD_HEIGHT - 1; y >= 0 && remaining != 0; y--) {
+        Board::Row found = board.getRow(y) & remaining;
+        for (int x = 0; x < FIELD_WIDTH; x++) {
+            if ((found >> x) & 1u) {
+                columnHeights[x] = y + 1;
+            }
+        }
+        remaining &= static_cast<Board::Row>(~found);
+    }
+}
@@ -0,0 +1,124 @@
+#include "GameRenderer.h"
+#include "GridMesher.h"
+#include "Profiler.h"
+#include <glm/gtc/matrix_transform.hpp>
+
+const glm::vec3 GameRenderer::WALL_COLOR(0.3f, 0.3f, 0.3f);
+
+GameRenderer::GameRenderer() : instanceStream(64 * 1024),
+                               stackMesh(GameField::FIELD_WIDTH, GameField::FIELD_HEIGHT),
+                               drawnGeneration(~0u), wallMeshWidth(0), wallMeshHeight(0) {
+    initializeWalls();
+    
+    // camera qui regarde le terrain
+    view = glm::lookAt(
+        glm::vec3(20.0f, 25.0f, 70.0f),
+        glm::vec3(4.5f, 7.5f, 0.0f),
+        glm::vec3(0.0f, 1.0f, 0.0f)
+    );
+    
+    projection = glm::perspective(
+        glm::radians(15.0f),
+        1200.0f / 900.0f, 
+        0.1f, 
+        100.0f
+    );
+}
+
+void GameRenderer::render(const GameField& game, float alpha) {
+    PROFILE_ZONE("render");
+    
+    // camera et lumiere envoyees une seule fois pour toute la frame
+    frameUniforms.update(view, projection,
+                         glm::vec3(10.0f, 15.0f, 10.0f),
+                         glm::vec3(1.0f, 1.0f, 1.0f),
+                         glm::vec3(10.0f, 15.0f, 35.0f));
+    
+    instanceStream.beginFrame();
+    passTimer.beginFrame();
+    boardRenderer.begin();
+    
+    // les cubes poses, regeneres seulement si une ligne a change
+    {
+        PROFILE_ZONE("stack rebuild");
+        syncStack(game);
+        const Board& board = game.getBoard();
+        stackMesh.rebuild([&board](int x, int y) { return board.getCell(x, y); });
+    }
+    
+    // la piece qui tombe, interpolee depuis sa position au debut du tick
+    const Piece* piece = game.getCurrentPiece();
+    if (piece != nullptr) {
+        glm::vec3 offset(0.0f);
+        if (game.isPieceMoving()) {
+            const Piece* previous = game.getPreviousPiece();
+            float remaining = 1.0f - glm::clamp(alpha, 0.0f, 1.0f);
+            offset.x = (previous->getX() - piece->getX()) * remaining;
+            offset.y = (previous->getY() - piece->getY()) * remaining;
+        }
+        
+        glm::vec3 color = GridMesher::cellColor(piece->getColor());
+        for (const auto& pos : piece->getBlockPositions()) {
+            boardRenderer.addCube(glm::vec3(static_cast<float>(pos.x), static_cast<float>(pos.y), 0.0f) + offset, color);
+        }
+    }
+    
+    // soumission des draw calls, passe par passe
+    {
+        PROFILE_ZONE("draw walls");
+        passTimer.begin(RenderPass::WALLS);
+        wallMesh.draw();
+        passTimer.end();
+    }
+    {
+        PROFILE_ZONE("draw stack");
+        passTimer.begin(RenderPass::STACK);
+        stackMesh.draw();
+        passTimer.end();
+    }
+    {
+        PROFILE_ZONE("draw piece");
+        passTimer.begin(RenderPass::PIECE);
+        boardRenderer.draw(instanceStream);
+        passTimer.end();
+    }
+    
+    instanceStream.endFrame();
+}
+
+void GameRenderer::syncStack(const GameField& game) {
+    if (game.getGeneration() == drawnGeneration) return;
+    drawnGeneration = game.getGeneration();
+    
+    // le jeu ne connait pas le mesh: on compare avec le terrain deja dessine
+    const Board& board = game.getBoard();
+    for (int y = 0; y < GameField::FIELD_HEIGHT; y++) {
+        if (!board.sameRow(drawnBoard, y)) {
+            stackMesh.markRowsDirty(y, y);
+        }
+    }
+    drawnBoard = board;
+}
+
+void GameRenderer::initializeWalls() {
+    const int width = GameField::FIELD_WIDTH;
+    const int height = GameField::FIELD_HEIGHT;
+    
+    // les murs ne bougent jamais, on ne les regenere que si le terrain change de taille
+    if (wallMeshWidth == width && wallMeshHeight == height) return;
+    
+    // un seul mesh statique, sans les faces entre deux cubes de mur
+    const Board::Cell wallCell = Board::makeCell(WALL_COLOR.r, WALL_COLOR.g, WALL_COLOR.b);
+    auto isWall = [wallCell](int x, int y) -> Board::Cell {
+        bool bottom = y == -1 && x >= -1 && x <= width;
+        bool side = (x == -1 || x == width) && y >= -1 && y < height + 2;
+        return bottom || side ? wallCell : Board::EMPTY;
+    };
+    
+    std::vector<BlockVertex> vertices;
+    GridMesher::meshRows(-1, width + 1, -1, height + 2, isWall, vertices);
+    wallMesh.upload(vertices, GL_STATIC_DRAW);
+    
+    wallMeshWidth = width;
+    wallMeshHeight = height;
+}
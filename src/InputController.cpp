@@ -0,0 +1,98 @@
+#include "InputController.h"
+
+InputController::InputController() : head(0), count(0), das(DEFAULT_DAS), arr(DEFAULT_ARR),
+                                     leftHeld(false), rightHeld(false), shiftDirection(0), nextShift(0.0) {
+}
+
+void InputController::setAutoShift(double das, double arr) {
+    this->das = das < 0.0 ? 0.0 : das;
+    this->arr = arr < 0.0 ? 0.0 : arr;
+}
+
+bool InputController::push(const InputEvent& event) {
+    if (count == QUEUE_SIZE) return false;
+    
+    queue[(head + count) % QUEUE_SIZE] = event;
+    count++;
+    return true;
+}
+
+void InputController::process(GameField& game, double time) {
+    // les evenements arrivent dans l'ordre: on s'arrete au premier qui est apres ce tick
+    while (count > 0 && queue[head].time <= time) {
+        const InputEvent& event = queue[head];
+        
+        // les repetitions dues avant l'evenement passent d'abord
+        autoShift(game, event.time);
+        apply(game, event);
+        
+        head = (head + 1) % QUEUE_SIZE;
+        count--;
+    }
+    
+    autoShift(game, time);
+}
+
+void InputController::reset() {
+    head = 0;
+    count = 0;
+    leftHeld = false;
+    rightHeld = false;
+    shiftDirection = 0;
+}
+
+void InputController::apply(GameField& game, const InputEvent& event) {
+    switch (event.action) {
+        case InputAction::MOVE_LEFT:
+        case InputAction::MOVE_RIGHT: {
+            int direction = event.action == InputAction::MOVE_LEFT ? -1 : 1;
+            if (direction < 0) {
+                leftHeld = event.pressed;
+            } else {
+                rightHeld = event.pressed;
+            }
+            
+            if (event.pressed) {
+                // un pas tout de suite, puis les repetitions apres le DAS
+                game.moveCurrentPiece(direction, 0);
+                shiftDirection = direction;
+                nextShift = event.time + das;
+            } else if (shiftDirection == direction) {
+                // on relache la direction active: l'autre reprend si elle est encore tenue
+                bool otherHeld = direction < 0 ? rightHeld : leftHeld;
+                shiftDirection = otherHeld ? -direction : 0;
+                nextShift = event.time + das;
+            }
+            break;
+        }
+        
+        case InputAction::ROTATE_CW:
+            if (event.pressed) game.rotateCurrentPiece(1);
+            break;
+            
+        case InputAction::ROTATE_CCW:
+            if (event.pressed) game.rotateCurrentPiece(-1);
+            break;
+            
+        case InputAction::HARD_DROP:
+            if (event.pressed) game.dropCurrentPiece();
+            break;
+    }
+}
+
+void InputController::autoShift(GameField& game, double time) {
+    if (shiftDirection == 0 || nextShift > time) return;
+    
+    if (arr <= 0.0) {
+        // repetition instantanee: contre le mur
+        for (int i = 0; i < GameField::FIELD_WIDTH; i++) {
+            game.moveCurrentPiece(shiftDirection, 0);
+        }
+        return;
+    }
+    
+    while (nextShift <= time) {
+        game.moveCurrentPiece(shiftDirection, 0);
+        nextShift += arr;
+    }
+}
@@ -0,0 +1,210 @@
+#include "Log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+static_assert((Log::RING_SIZE & (Log::RING_SIZE - 1)) == 0, "RING_SIZE doit etre une puissance de 2");
+
+struct Record {
+    // protocole de la file bornee de Vyukov: sequence == position quand la case est libre,
+    // position + 1 quand le message est pret a etre lu
+    std::atomic<uint64_t> sequence;
+    LogLevel level;
+    uint64_t time;
+    const char* message;
+    int fieldCount;
+    LogField fields[Log::MAX_FIELDS];
+    // les textes des champs, copies a la suite
+    char text[Log::TEXT_SIZE];
+};
+
+Record ring[Log::RING_SIZE];
+std::atomic<uint64_t> enqueuePosition{0};
+// seul le thread de fond avance la lecture
+std::atomic<uint64_t> dequeuePosition{0};
+std::atomic<uint64_t> dropped{0};
+std::atomic<int> minimumLevel{static_cast<int>(LogLevel::INFO)};
+
+const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+const char* levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::DEBUG: return "DEBUG";
+        case LogLevel::INFO: return "INFO";
+        case LogLevel::WARNING: return "WARNING";
+        case LogLevel::ERROR: return "ERROR";
+    }
+    return "";
+}
+
+// ecrit un message formate; buffer local, un seul fwrite par ligne
+void print(const Record& record) {
+    char line[1024];
+    int length = std::snprintf(line, sizeof(line), "[%10.3f] %-7s %s",
+                               record.time / 1.0e9, levelName(record.level), record.message);
+    
+    for (int i = 0; i < record.fieldCount && length < static_cast<int>(sizeof(line)); i++) {
+        const LogField& field = record.fields[i];
+        char* out = line + length;
+        size_t space = sizeof(line) - length;
+        switch (field.type) {
+            case LogField::Type::INT:
+                length += std::snprintf(out, space, " %s=%lld", field.key, static_cast<long long>(field.intValue));
+                break;
+            case LogField::Type::UINT:
+                length += std::snprintf(out, space, " %s=%llu", field.key, static_cast<unsigned long long>(field.uintValue));
+                break;
+            case LogField::Type::FLOAT:
+                length += std::snprintf(out, space, " %s=%g", field.key, field.floatValue);
+                break;
+            case LogField::Type::TEXT:
+                // entre guillemets s'il contient des espaces, pour rester lisible par un script
+                length += std::snprintf(out, space, std::strchr(field.textValue, ' ') ? " %s=\"%s\"" : " %s=%s",
+                                        field.key, field.textValue);
+                break;
+        }
+    }
+    
+    length = std::min(length, static_cast<int>(sizeof(line)) - 2);
+    line[length++] = '\n';
+    std::fwrite(line, 1, length, stdout);
+}
+
+// ecrit tous les messages prets, retourne false si rien a faire
+bool drain() {
+    uint64_t position = dequeuePosition.load(std::memory_order_relaxed);
+    Record* record = &ring[position & (Log::RING_SIZE - 1)];
+    if (record->sequence.load(std::memory_order_acquire) != position + 1) return false;
+    
+    do {
+        print(*record);
+        // case rendue aux producteurs pour le tour suivant
+        record->sequence.store(position + Log::RING_SIZE, std::memory_order_release);
+        position++;
+        dequeuePosition.store(position, std::memory_order_release);
+        record = &ring[position & (Log::RING_SIZE - 1)];
+    } while (record->sequence.load(std::memory_order_acquire) == position + 1);
+    
+    static uint64_t reportedDrops = 0;
+    uint64_t drops = dropped.load(std::memory_order_relaxed);
+    if (drops != reportedDrops) {
+        std::fprintf(stdout, "[log] %llu messages dropped\n", static_cast<unsigned long long>(drops - reportedDrops));
+        reportedDrops = drops;
+    }
+    
+    std::fflush(stdout);
+    return true;
+}
+
+// thread de fond, demarre au premier message et arrete a la fin du process apres avoir tout ecrit
+class Writer {
+public:
+    void start() {
+        std::call_once(started, [this] {
+            for (int i = 0; i < Log::RING_SIZE; i++) {
+                ring[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            thread = std::thread([this] { run(); });
+        });
+    }
+
+    ~Writer() {
+        if (!thread.joinable()) return;
+        running = false;
+        thread.join();
+    }
+
+private:
+    void run() {
+        // rien a faire: on dort un peu, le jeu ne reveille jamais ce thread
+        while (running.load(std::memory_order_relaxed)) {
+            if (!drain()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+        drain();
+    }
+
+    std::once_flag started;
+    std::atomic<bool> running{true};
+    std::thread thread;
+};
+
+Writer writer;
+
+}
+
+void Log::setLevel(LogLevel level) {
+    minimumLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+LogLevel Log::getLevel() {
+    return static_cast<LogLevel>(minimumLevel.load(std::memory_order_relaxed));
+}
+
+void Log::write(LogLevel level, const char* message, std::initializer_list<LogField> fields) {
+    if (!isEnabled(level)) return;
+    writer.start();
+    
+    // reserve une case libre; file pleine = message perdu, jamais d'attente
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Record* record;
+    for (;;) {
+        record = &ring[position & (RING_SIZE - 1)];
+        int64_t difference = static_cast<int64_t>(record->sequence.load(std::memory_order_acquire) - position);
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (difference < 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+    
+    record->level = level;
+    record->time = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime).count());
+    record->message = message;
+    record->fieldCount = 0;
+    
+    size_t textUsed = 0;
+    for (const LogField& field : fields) {
+        if (record->fieldCount == MAX_FIELDS) break;
+        LogField& stored = record->fields[record->fieldCount++];
+        stored = field;
+        
+        if (field.type == LogField::Type::TEXT) {
+            // copie dans le message: le texte d'origine peut disparaitre avant l'ecriture
+            // la derniere case reste toujours libre pour le '\0'
+            size_t space = static_cast<size_t>(TEXT_SIZE) - 1 - textUsed;
+            size_t length = std::min(std::strlen(field.textValue), space);
+            std::memcpy(record->text + textUsed, field.textValue, length);
+            record->text[textUsed + length] = '\0';
+            stored.textValue = record->text + textUsed;
+            textUsed = std::min(textUsed + length + 1, static_cast<size_t>(TEXT_SIZE) - 1);
+        }
+    }
+    
+    record->sequence.store(position + 1, std::memory_order_release);
+}
+
+void Log::flush() {
+    if (enqueuePosition.load(std::memory_order_acquire) == 0) return;
+    
+    // le thread de fond rattrape tout ce qui a ete reserve avant l'appel
+    uint64_t target = enqueuePosition.load(std::memory_order_acquire);
+    while (dequeuePosition.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+uint64_t Log::getDropped() {
+    return dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,53 @@
+#include "PassTimer.h"
+
+PassTimer::PassTimer() : currentFrame(0), activePass(-1) {
+    glGenQueries(FRAME_COUNT * RenderStats::PASS_COUNT, &queries[0][0]);
+    for (int frame = 0; frame < FRAME_COUNT; frame++) {
+        for (int pass = 0; pass < RenderStats::PASS_COUNT; pass++) {
+            pending[frame][pass] = false;
+        }
+    }
+}
+
+PassTimer::~PassTimer() {
+    glDeleteQueries(FRAME_COUNT * RenderStats::PASS_COUNT, &queries[0][0]);
+}
+
+void PassTimer::beginFrame() {
+    currentFrame = (currentFrame + 1) % FRAME_COUNT;
+    collect(currentFrame);
+}
+
+void PassTimer::collect(int frame) {
+    for (int pass = 0; pass < RenderStats::PASS_COUNT; pass++) {
+        if (!pending[frame][pass]) continue;
+        pending[frame][pass] = false;
+        
+        // pas encore pret apres FRAME_COUNT frames: on perd cette mesure plutot que de bloquer
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(queries[frame][pass], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) continue;
+        
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(queries[frame][pass], GL_QUERY_RESULT, &elapsed);
+        RenderStats::setPassGpuTime(static_cast<RenderPass>(pass), elapsed / 1.0e6);
+    }
+}
+
+void PassTimer::begin(RenderPass pass) {
+    activePass = static_cast<int>(pass);
+    glBeginQuery(GL_TIME_ELAPSED, queries[currentFrame][activePass]);
+    cpuStart = std::chrono::steady_clock::now();
+}
+
+void PassTimer::end() {
+    if (activePass < 0) return;
+    
+    auto cpuEnd = std::chrono::steady_clock::now();
+    glEndQuery(GL_TIME_ELAPSED);
+    pending[currentFrame][activePass] = true;
+    
+    RenderStats::setPassCpuTime(static_cast<RenderPass>(activePass),
+                                std::chrono::duration<double, std::milli>(cpuEnd - cpuStart).count());
+    activePass = -1;
+}
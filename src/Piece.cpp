@@ -1,107 +1,46 @@
 #include "Piece.h"
-#include <random>
-#include <ctime>
 
-Piece::Piece(PieceType type, float x, float y) : type(type), x(x), y(y) {
-    color = getRandomColor();
-    initializePiece(type);
-    updateCubePositions();
+Piece::Piece(PieceType type, int x, int y) : type(type), rotation(0), x(x), y(y), color(getTypeColor(type)) {
 }
 
-Piece::~Piece() {
-    // nettoie les cubes
-    for (Cube* cube : cubes) {
-        delete cube;
-    }
-}
-
-void Piece::initializePiece(PieceType type) {
-    shape.clear();
-    
-    // formes des pieces tetris classiques
-    switch (type) {
-        case PieceType::I: // barre droite
-            shape = {{-2, 0}, {-1, 0}, {0, 0}, {1, 0}};
-            break;
-        case PieceType::T: // piece en T
-            shape = {{0, 0}, {-1, 0}, {1, 0}, {0, 1}};
-            break;
-        case PieceType::S: // piece en S
-            shape = {{0, 0}, {0, 1}, {1, 1}, {1, 2}};
-            break;
-        case PieceType::Z: // piece en Z
-            shape = {{1, 0}, {1, 1}, {0, 1}, {0, 2}};
-            break;
-        case PieceType::J: // piece en J
-            shape = {{0, 0}, {0, 1}, {0, -1}, {-1, -1}};
-            break;
-        case PieceType::L: // piece en L
-            shape = {{0, 0}, {0, 1}, {0, -1}, {1, -1}};
-            break;
-        default: // fallback sur la barre
-            shape = {{-2, 0}, {-1, 0}, {0, 0}, {1, 0}};
-            break;
-    }
-    
-    // cree un cube pour chaque bloc de la piece
-    for (size_t i = 0; i < shape.size(); i++) {
-        cubes.push_back(new Cube(0, 0, 0, color));
-    }
-}
-
-void Piece::updateCubePositions() {
-    // met a jour la position de chaque cube
-    for (size_t i = 0; i < cubes.size(); i++) {
-        cubes[i]->setPosition(x + shape[i].x, y + shape[i].y, 0);
-        cubes[i]->setColor(color);
-    }
+Piece::Piece(PieceType type, int x, int y, Board::Cell color) : type(type), rotation(0), x(x), y(y), color(color) {
 }
 
-void Piece::render(const glm::mat4& view, const glm::mat4& projection) {
-    // dessine tous les cubes de la piece
-    for (Cube* cube : cubes) {
-        cube->render(view, projection);
-    }
-}
-
-void Piece::move(float dx, float dy) {
+void Piece::move(int dx, int dy) {
     // deplace la piece
     x += dx;
     y += dy;
-    updateCubePositions();
 }
 
-void Piece::setPosition(float x, float y) {
+void Piece::rotate(int direction) {
+    rotation = (rotation + (direction > 0 ? 1 : PieceShapes::ROTATION_COUNT - 1)) % PieceShapes::ROTATION_COUNT;
+}
+
+void Piece::setPosition(int x, int y) {
     // change la position de la piece
     this->x = x;
     this->y = y;
-    updateCubePositions();
 }
 
-std::vector<glm::vec2> Piece::getBlockPositions() const {
+Piece::Blocks Piece::getBlockPositions() const {
     // retourne toutes les positions des blocs
-    std::vector<glm::vec2> positions;
-    for (const auto& block : shape) {
-        positions.push_back({x + block.x, y + block.y});
+    Blocks positions = getShape();
+    for (auto& block : positions) {
+        block.x += x;
+        block.y += y;
     }
     return positions;
 }
 
-glm::vec3 Piece::getRandomColor() {
-    static std::mt19937 rng(time(0));
-    static std::uniform_real_distribution<float> dist(0.2f, 0.9f);
-    
-    // genere des couleurs vives
-    float r = dist(rng);
-    float g = dist(rng);
-    float b = dist(rng);
-    
-    float maxComp = std::max(std::max(r, g), b);
-    if (maxComp < 0.7f) {
-        if (r == maxComp) r = 0.8f;
-        else if (g == maxComp) g = 0.8f;
-        else b = 0.8f;
+Board::Cell Piece::getTypeColor(PieceType type) {
+    switch (type) {
+        case PieceType::I: return Board::makeCell(0.2f, 0.8f, 0.9f);
+        case PieceType::T: return Board::makeCell(0.7f, 0.3f, 0.8f);
+        case PieceType::S: return Board::makeCell(0.3f, 0.8f, 0.3f);
+        case PieceType::Z: return Board::makeCell(0.9f, 0.3f, 0.3f);
+        case PieceType::J: return Board::makeCell(0.3f, 0.4f, 0.9f);
+        case PieceType::L: return Board::makeCell(0.9f, 0.6f, 0.2f);
     }
-    
-    return glm::vec3(r, g, b);
-}
\ No newline at end of file
+    return Board::makeCell(0.5f, 0.5f, 0.5f);
+}
+
@@ -0,0 +1,31 @@
+#include "PieceBag.h"
+#include <utility>
+
+PieceBag::PieceBag(uint64_t seed) : random(seed), index(PieceShapes::TYPE_COUNT) {
+}
+
+void PieceBag::setSeed(uint64_t seed) {
+    random.setSeed(seed);
+    // le sac en cours est jete, le prochain tirage en remplit un nouveau
+    index = PieceShapes::TYPE_COUNT;
+}
+
+PieceType PieceBag::next() {
+    if (index >= PieceShapes::TYPE_COUNT) {
+        refill();
+    }
+    return bag[index++];
+}
+
+void PieceBag::refill() {
+    for (int i = 0; i < PieceShapes::TYPE_COUNT; i++) {
+        bag[i] = static_cast<PieceType>(i);
+    }
+    
+    // Fisher-Yates
+    for (int i = PieceShapes::TYPE_COUNT - 1; i > 0; i--) {
+        int j = static_cast<int>(random.nextBelow(static_cast<uint32_t>(i + 1)));
+        std::swap(bag[i], bag[j]);
+    }
+    index = 0;
+}
@@ -0,0 +1,120 @@
+#include "Profiler.h"
+
+#ifdef TETRIS_PROFILER
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct ZoneEvent {
+    const char* name;
+    uint64_t start, end;
+};
+
+struct ThreadRing {
+    int threadId;
+    // nombre total de zones ecrites, l'index dans le buffer est written % RING_SIZE
+    std::atomic<uint64_t> written{0};
+    std::array<ZoneEvent, Profiler::RING_SIZE> events;
+};
+
+// les buffers vivent jusqu'a la fin du process pour pouvoir dumper apres la fin d'un thread
+std::mutex ringsMutex;
+std::vector<std::unique_ptr<ThreadRing>> rings;
+
+const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+ThreadRing& currentRing() {
+    // cree une fois par thread, ensuite plus aucun verrou
+    thread_local ThreadRing* ring = nullptr;
+    if (ring == nullptr) {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.push_back(std::unique_ptr<ThreadRing>(new ThreadRing()));
+        ring = rings.back().get();
+        ring->threadId = static_cast<int>(rings.size());
+    }
+    return *ring;
+}
+
+void writeString(FILE* file, const char* text) {
+    fputc('"', file);
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', file);
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+}
+
+bool Profiler::isEnabled() {
+    return true;
+}
+
+uint64_t Profiler::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime).count());
+}
+
+void Profiler::record(const char* name, uint64_t start, uint64_t end) {
+    ThreadRing& ring = currentRing();
+    uint64_t index = ring.written.load(std::memory_order_relaxed);
+    ring.events[index % RING_SIZE] = {name, start, end};
+    ring.written.store(index + 1, std::memory_order_release);
+}
+
+bool Profiler::writeChromeTrace(const char* path) {
+    FILE* file = std::fopen(path, "w");
+    if (file == nullptr) return false;
+    
+    std::fputs("{\"traceEvents\":[\n", file);
+    bool first = true;
+    
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    for (const auto& ring : rings) {
+        // seulement les zones encore dans le buffer
+        uint64_t written = ring->written.load(std::memory_order_acquire);
+        uint64_t begin = written > RING_SIZE ? written - RING_SIZE : 0;
+        
+        for (uint64_t i = begin; i < written; i++) {
+            const ZoneEvent& event = ring->events[i % RING_SIZE];
+            std::fputs(first ? "" : ",\n", file);
+            first = false;
+            
+            // evenement complet ("X"), temps en microsecondes
+            std::fputs("{\"name\":", file);
+            writeString(file, event.name);
+            std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                         ring->threadId, event.start / 1000.0, (event.end - event.start) / 1000.0);
+        }
+    }
+    
+    std::fputs("\n]}\n", file);
+    std::fclose(file);
+    return true;
+}
+
+#else
+
+bool Profiler::isEnabled() {
+    return false;
+}
+
+uint64_t Profiler::now() {
+    return 0;
+}
+
+void Profiler::record(const char*, uint64_t, uint64_t) {
+}
+
+bool Profiler::writeChromeTrace(const char*) {
+    return false;
+}
+
+#endif
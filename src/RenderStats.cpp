@@ -0,0 +1,39 @@
+#include "RenderStats.h"
+
+int RenderStats::drawCalls = 0;
+long RenderStats::vertices = 0;
+double RenderStats::passCpuTimes[PASS_COUNT] = {0.0, 0.0, 0.0};
+double RenderStats::passGpuTimes[PASS_COUNT] = {-1.0, -1.0, -1.0};
+bool RenderStats::passGpuFresh[PASS_COUNT] = {false, false, false};
+
+void RenderStats::beginFrame() {
+    drawCalls = 0;
+    vertices = 0;
+    // les temps GPU restent: ils arrivent avec du retard
+    for (double& time : passCpuTimes) {
+        time = 0.0;
+    }
+}
+
+void RenderStats::countDraw(long vertexCount) {
+    drawCalls++;
+    vertices += vertexCount;
+}
+
+bool RenderStats::takePassGpuTime(RenderPass pass, double& ms) {
+    int index = static_cast<int>(pass);
+    if (!passGpuFresh[index]) return false;
+    
+    passGpuFresh[index] = false;
+    ms = passGpuTimes[index];
+    return true;
+}
+
+const char* RenderStats::getPassName(RenderPass pass) {
+    switch (pass) {
+        case RenderPass::WALLS: return "walls";
+        case RenderPass::STACK: return "stack";
+        case RenderPass::PIECE: return "piece";
+    }
+    return "";
+}
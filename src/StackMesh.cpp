@@ -0,0 +1,25 @@
+#include "StackMesh.h"
+#include <algorithm>
+
+StackMesh::StackMesh(int width, int height)
+    : width(width), height(height), dirty(false), dirtyRows(height, false), rowVertices(height) {
+}
+
+void StackMesh::markRowsDirty(int firstRow, int lastRow) {
+    // les faces du haut et du bas dependent des lignes voisines
+    firstRow = std::max(firstRow - 1, 0);
+    lastRow = std::min(lastRow + 1, height - 1);
+
+    for (int y = firstRow; y <= lastRow; y++) {
+        dirtyRows[y] = true;
+        dirty = true;
+    }
+}
+
+void StackMesh::markAllDirty() {
+    markRowsDirty(0, height - 1);
+}
+
+void StackMesh::draw() const {
+    mesh.draw();
+}
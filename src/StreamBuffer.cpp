@@ -0,0 +1,149 @@
+#include "StreamBuffer.h"
+#include <cstring>
+
+StreamBuffer::StreamBuffer(size_t regionSize)
+    : buffer(0), regionSize(regionSize), currentRegion(0), regionOffset(0),
+      persistent(false), mappedData(nullptr) {
+    for (int i = 0; i < REGION_COUNT; i++) {
+        fences[i] = nullptr;
+    }
+    create();
+}
+
+StreamBuffer::~StreamBuffer() {
+    destroy();
+}
+
+bool StreamBuffer::hasBufferStorage() {
+    // glad ne charge glBufferStorage que si le contexte le supporte
+    if (glBufferStorage == NULL) return false;
+    if (GLAD_GL_VERSION_4_4) return true;
+
+    int extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (int i = 0; i < extensionCount; i++) {
+        const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (name != nullptr && std::strcmp(name, "GL_ARB_buffer_storage") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void StreamBuffer::create() {
+    GLsizeiptr totalSize = static_cast<GLsizeiptr>(regionSize * REGION_COUNT);
+
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    persistent = hasBufferStorage();
+    if (persistent) {
+        // mappe une fois pour toute la duree de vie du buffer
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, totalSize, NULL, flags);
+        mappedData = static_cast<char*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, totalSize, flags));
+        if (mappedData == nullptr) {
+            // mapping refuse: on repart sur un buffer classique
+            glDeleteBuffers(1, &buffer);
+            glGenBuffers(1, &buffer);
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+            persistent = false;
+        }
+    }
+
+    if (!persistent) {
+        glBufferData(GL_ARRAY_BUFFER, totalSize, NULL, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void StreamBuffer::destroy() {
+    for (int i = 0; i < REGION_COUNT; i++) {
+        if (fences[i] != nullptr) {
+            glDeleteSync(fences[i]);
+            fences[i] = nullptr;
+        }
+    }
+
+    if (persistent && mappedData != nullptr) {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    mappedData = nullptr;
+
+    glDeleteBuffers(1, &buffer);
+    buffer = 0;
+}
+
+void StreamBuffer::waitForRegion(int region) {
+    if (fences[region] == nullptr) return;
+
+    // normalement deja signalee: le GPU a deux frames d'avance pour la consommer
+    GLenum result = glClientWaitSync(fences[region], 0, 0);
+    while (result == GL_TIMEOUT_EXPIRED) {
+        result = glClientWaitSync(fences[region], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+    }
+
+    glDeleteSync(fences[region]);
+    fences[region] = nullptr;
+}
+
+void StreamBuffer::beginFrame() {
+    currentRegion = (currentRegion + 1) % REGION_COUNT;
+    regionOffset = 0;
+    waitForRegion(currentRegion);
+}
+
+void StreamBuffer::endFrame() {
+    // le GPU lit cette region jusqu'a ce que la fence soit signalee
+    if (fences[currentRegion] != nullptr) {
+        glDeleteSync(fences[currentRegion]);
+    }
+    fences[currentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void StreamBuffer::grow(size_t minRegionSize) {
+    // rare: on attend que le GPU ait fini avec toutes les regions avant de tout recreer
+    for (int i = 0; i < REGION_COUNT; i++) {
+        waitForRegion(i);
+    }
+    destroy();
+
+    while (regionSize < minRegionSize) {
+        regionSize *= 2;
+    }
+    create();
+
+    currentRegion = 0;
+    regionOffset = 0;
+}
+
+size_t StreamBuffer::write(const void* data, size_t size, size_t alignment) {
+    if (size == 0) return currentRegion * regionSize + regionOffset;
+
+    size_t start = (regionOffset + alignment - 1) / alignment * alignment;
+    if (start + size > regionSize) {
+        grow(start + size);
+        start = 0;
+    }
+
+    size_t offset = currentRegion * regionSize + start;
+
+    if (persistent) {
+        std::memcpy(mappedData + offset, data, size);
+    } else {
+        // pas de synchro implicite: la fence de la region garantit que le GPU l'a liberee
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        void* dst = glMapBufferRange(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size),
+                                     GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (dst != nullptr) {
+            std::memcpy(dst, data, size);
+        }
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
+    regionOffset = start + size;
+    return offset;
+}
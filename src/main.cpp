@@ -1,56 +1,207 @@
 #include "GameField.h"
+#include "GameRenderer.h"
+#include "InputController.h"
+#include "FrameTimes.h"
+#include "Log.h"
+#include "RenderStats.h"
+#include "Profiler.h"
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
-#include <iostream>
 #include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <string>
 
 const unsigned int SCR_WIDTH = 1200;
 const unsigned int SCR_HEIGHT = 900;
 
+// comment la boucle cadence les images
+enum class FrameMode {
+    VSYNC,      // redessine seulement si besoin, synchro ecran
+    CAPPED,     // redessine seulement si besoin, au plus maxFps images par seconde
+    UNCAPPED    // redessine en continu sans attendre (benchmark)
+};
+
 GameField* gameField = nullptr;
+GameRenderer* gameRenderer = nullptr;
+InputController inputController;
+FrameMode frameMode = FrameMode::VSYNC;
+double maxFps = 60.0;
+// 0 = graine tiree de l'heure
+uint64_t gameSeed = 0;
+bool windowDamaged = true;
+// fichier de trace du profiler (F3 ou sortie du jeu), seulement si compile avec TETRIS_PROFILER
+const char* tracePath = "tetris_trace.json";
+// durees de chaque image, rapport a la sortie; fichiers <frameStatsPath>.csv/.json sur F4
+// ou a la sortie si --frame-stats est donne
+FrameTimes frameTimes;
+std::string frameStatsPath;
+// budget d'une image en ms, 0 = deduit du mode d'affichage
+double frameBudget = 0.0;
+
+const char* frameModeName(FrameMode mode) {
+    switch (mode) {
+        case FrameMode::VSYNC: return "vsync";
+        case FrameMode::CAPPED: return "capped";
+        case FrameMode::UNCAPPED: return "uncapped";
+    }
+    return "";
+}
+
+void applyFrameMode() {
+    glfwSwapInterval(frameMode == FrameMode::VSYNC ? 1 : 0);
+    windowDamaged = true;
+    if (frameMode == FrameMode::CAPPED) {
+        Log::info("frame mode", {{"mode", frameModeName(frameMode)}, {"fps", maxFps}});
+    } else {
+        Log::info("frame mode", {{"mode", frameModeName(frameMode)}});
+    }
+}
+
+void dumpTrace() {
+    if (!Profiler::isEnabled()) return;
+    
+    if (Profiler::writeChromeTrace(tracePath)) {
+        Log::info("trace written", {{"path", tracePath}});
+    } else {
+        Log::error("failed to write trace", {{"path", tracePath}});
+    }
+}
+
+void writeFrameTimes() {
+    // le rapport va directement sur la sortie: on laisse d'abord passer les logs en attente
+    Log::flush();
+    frameTimes.printReport();
+    
+    std::string base = frameStatsPath.empty() ? "frame_times" : frameStatsPath;
+    if (frameTimes.writeCsv(base + ".csv") && frameTimes.writeJson(base + ".json")) {
+        Log::info("frame times written", {{"csv", base + ".csv"}, {"json", base + ".json"}});
+    } else {
+        Log::error("failed to write frame times", {{"path", base}});
+    }
+}
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
     glViewport(0, 0, width, height);
+    windowDamaged = true;
 }
 
-void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
-    if (action == GLFW_PRESS || action == GLFW_REPEAT) {
-        if (gameField) {
-            GameState state = gameField->getGameState();
+void window_refresh_callback(GLFWwindow*) {
+    // fenetre decouverte ou redimensionnee: le contenu doit etre redessine
+    windowDamaged = true;
+}
+
+// horloge commune aux evenements clavier et a la simulation
+double now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool keyToAction(int key, InputAction& action) {
+    switch (key) {
+        case GLFW_KEY_A:
+        case GLFW_KEY_LEFT:
+            action = InputAction::MOVE_LEFT;
+            return true;
             
-            // si c'est fini on relance
-            if (state == GameState::GAME_OVER) {
-                gameField->restartGame();
-                return;
-            }
+        case GLFW_KEY_E:
+        case GLFW_KEY_RIGHT:
+            action = InputAction::MOVE_RIGHT;
+            return true;
             
-            if (state == GameState::PLAYING) {
-                switch (key) {
-                    case GLFW_KEY_A:
-                    case GLFW_KEY_LEFT:
-                        gameField->moveCurrentPiece(-1, 0);
-                        break;
-                        
-                    case GLFW_KEY_E:
-                    case GLFW_KEY_RIGHT:
-                        gameField->moveCurrentPiece(1, 0);
-                        break;
-                        
-                    case GLFW_KEY_S:
-                    case GLFW_KEY_DOWN:
-                        gameField->dropCurrentPiece();
-                        break;
-                        
-                    case GLFW_KEY_ESCAPE:
-                        glfwSetWindowShouldClose(window, true);
-                        break;
-                }
-            }
+        case GLFW_KEY_Z:
+        case GLFW_KEY_UP:
+            action = InputAction::ROTATE_CW;
+            return true;
+            
+        case GLFW_KEY_Q:
+            action = InputAction::ROTATE_CCW;
+            return true;
+            
+        case GLFW_KEY_S:
+        case GLFW_KEY_DOWN:
+            action = InputAction::HARD_DROP;
+            return true;
+    }
+    return false;
+}
+
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    // la repetition de l'OS est ignoree: l'auto-shift est gere par InputController
+    if (action == GLFW_REPEAT) return;
+    
+    if (action == GLFW_PRESS) {
+        // change de mode d'affichage: vsync -> capped -> uncapped
+        if (key == GLFW_KEY_F2) {
+            frameMode = static_cast<FrameMode>((static_cast<int>(frameMode) + 1) % 3);
+            applyFrameMode();
+            return;
+        }
+        
+        // trace des dernieres zones mesurees, a ouvrir dans chrome://tracing ou Perfetto
+        if (key == GLFW_KEY_F3) {
+            dumpTrace();
+            return;
+        }
+        
+        // percentiles des temps d'image depuis le lancement
+        if (key == GLFW_KEY_F4) {
+            writeFrameTimes();
+            return;
+        }
+        
+        if (key == GLFW_KEY_ESCAPE) {
+            glfwSetWindowShouldClose(window, true);
+            return;
+        }
+        
+        // si c'est fini on relance
+        if (gameField && gameField->getGameState() == GameState::GAME_OVER) {
+            gameField->restartGame();
+            inputController.reset();
+            return;
+        }
+    }
+    
+    // le reste part dans la file, consomme au prochain tick
+    InputAction inputAction;
+    if (keyToAction(key, inputAction)) {
+        inputController.push({inputAction, action == GLFW_PRESS, now()});
+    }
+}
+
+void parseArguments(int argc, char** argv) {
+    // --vsync (defaut), --uncapped, --fps N, --seed N, --das MS, --arr MS, --trace FICHIER,
+    // --frame-stats FICHIER (sans extension), --budget MS
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--vsync") == 0) {
+            frameMode = FrameMode::VSYNC;
+        } else if (std::strcmp(argv[i], "--uncapped") == 0) {
+            frameMode = FrameMode::UNCAPPED;
+        } else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            frameMode = FrameMode::CAPPED;
+            maxFps = std::max(1.0, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            gameSeed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--das") == 0 && i + 1 < argc) {
+            inputController.setAutoShift(std::atof(argv[++i]) / 1000.0, inputController.getArr());
+        } else if (std::strcmp(argv[i], "--arr") == 0 && i + 1 < argc) {
+            inputController.setAutoShift(inputController.getDas(), std::atof(argv[++i]) / 1000.0);
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--frame-stats") == 0 && i + 1 < argc) {
+            frameStatsPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            frameBudget = std::max(0.0, std::atof(argv[++i]));
+        } else {
+            Log::warning("unknown argument", {{"argument", argv[i]}});
         }
     }
 }
 
-int main() {
+int main(int argc, char** argv) {
+    parseArguments(argc, argv);
+    
     // init opengl
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -59,56 +210,162 @@ int main() {
 
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Tetris 3D", NULL, NULL);
     if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
+        Log::error("failed to create GLFW window");
         glfwTerminate();
         return -1;
     }
     
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    glfwSetWindowRefreshCallback(window, window_refresh_callback);
     glfwSetKeyCallback(window, key_callback);
 
     // glad pour charger les fonctions opengl
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+        Log::error("failed to initialize GLAD");
         return -1;
     }
 
     glEnable(GL_DEPTH_TEST);
+    applyFrameMode();
+    
+    // par defaut une image doit tenir dans une periode d'ecran (ou 1/maxFps en mode limite)
+    if (frameBudget <= 0.0) {
+        const GLFWvidmode* videoMode = glfwGetVideoMode(glfwGetPrimaryMonitor());
+        double refreshRate = videoMode != nullptr && videoMode->refreshRate > 0 ? videoMode->refreshRate : 60.0;
+        frameBudget = 1000.0 / (frameMode == FrameMode::CAPPED ? maxFps : refreshRate);
+    }
+    frameTimes.setBudget(frameBudget);
     
-    gameField = new GameField();
+    gameField = gameSeed != 0 ? new GameField(gameSeed) : new GameField();
+    gameRenderer = new GameRenderer();
 
-    // pour faire tomber les pieces automatiquement
-    auto lastTime = std::chrono::high_resolution_clock::now();
-    float dropTimer = 0.0f;
-    const float DROP_INTERVAL = 1.0f;
+    // simulation a pas fixe: le temps ecoule s'accumule et part en ticks entiers
+    // le reste est garde pour la frame suivante et sert a interpoler le rendu
+    double lastTime = now();
+    double lastFrameTime = lastTime;
+    double accumulator = 0.0;
+    // apres une longue pause (fenetre deplacee, debugger) on ne rattrape pas tout
+    const double MAX_FRAME_TIME = 0.25;
+    // attente demandee au tour precedent: ce temps-la est prevu (gravite), il est compte en entier
+    double plannedWait = 0.0;
+    
+    // derniere version du terrain qui a ete dessinee
+    unsigned int drawnGeneration = gameField->getGeneration() - 1;
+    // la derniere image montrait la piece entre deux positions
+    bool drawnAnimating = false;
 
     // game loop
     while (!glfwWindowShouldClose(window)) {
-        auto currentTime = std::chrono::high_resolution_clock::now();
-        float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
+        double currentTime = now();
+        double deltaTime = currentTime - lastTime;
         lastTime = currentTime;
 
-        // update du jeu si on joue
-        if (gameField->getGameState() == GameState::PLAYING) {
-            dropTimer += deltaTime;
-            if (dropTimer >= DROP_INTERVAL) {
-                gameField->update();
-                dropTimer = 0.0f;
+        // seul ce qui depasse l'attente prevue (plus un tick de marge) est perdu
+        accumulator += std::min(deltaTime, std::max(MAX_FRAME_TIME, plannedWait + GameField::TICK_SECONDS));
+        plannedWait = 0.0;
+        // chaque tick consomme les entrees horodatees jusqu'a sa fin, puis avance le jeu
+        double simTime = currentTime - accumulator;
+        bool ticked = accumulator >= GameField::TICK_SECONDS;
+        while (accumulator >= GameField::TICK_SECONDS) {
+            PROFILE_ZONE("sim tick");
+            simTime += GameField::TICK_SECONDS;
+            {
+                PROFILE_ZONE("input");
+                inputController.process(*gameField, simTime);
             }
+            gameField->tick();
+            accumulator -= GameField::TICK_SECONDS;
         }
+        if (ticked) {
+            frameTimes.record(FrameTimer::UPDATE, now() - currentTime);
+        }
+        float alpha = static_cast<float>(accumulator / GameField::TICK_SECONDS);
 
-        // affichage
-        glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        // affichage seulement si quelque chose a change ou glisse encore (sauf en uncapped)
+        double sinceLastFrame = currentTime - lastFrameTime;
+        bool animating = gameField->isPieceMoving();
+        // glissade finie depuis la derniere image: encore une pour poser la piece sur sa case
+        bool slideEnded = drawnAnimating && !animating;
+        bool changed = windowDamaged || animating || slideEnded || gameField->getGeneration() != drawnGeneration;
+        bool frameDue = frameMode != FrameMode::CAPPED || sinceLastFrame >= 1.0 / maxFps;
+        
+        if (frameMode == FrameMode::UNCAPPED || (changed && frameDue)) {
+            double renderStart = now();
+            RenderStats::beginFrame();
+            glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        gameField->render();
+            gameRenderer->render(*gameField, alpha);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+            double swapStart = now();
+            {
+                PROFILE_ZONE("swap");
+                glfwSwapBuffers(window);
+            }
+            double frameEnd = now();
+            frameTimes.record(FrameTimer::RENDER, swapStart - renderStart);
+            frameTimes.record(FrameTimer::SWAP, frameEnd - swapStart);
+            frameTimes.record(FrameTimer::FRAME, frameEnd - currentTime);
+            
+            // temps GPU des passes, revenus quelques frames apres leur rendu
+            for (int pass = 0; pass < RenderStats::PASS_COUNT; pass++) {
+                double gpuMs;
+                if (RenderStats::takePassGpuTime(static_cast<RenderPass>(pass), gpuMs)) {
+                    frameTimes.record(static_cast<FrameTimer>(static_cast<int>(FrameTimer::GPU_WALLS) + pass), gpuMs / 1000.0);
+                }
+            }
+            
+            drawnGeneration = gameField->getGeneration();
+            windowDamaged = false;
+            lastFrameTime = currentTime;
+            sinceLastFrame = 0.0;
+            // tant que la piece glisse il faut d'autres images
+            changed = animating;
+            drawnAnimating = animating;
+        }
+
+        if (frameMode == FrameMode::UNCAPPED) {
+            PROFILE_ZONE("poll events");
+            glfwPollEvents();
+            continue;
+        }
+        
+        // sinon on dort jusqu'a une touche, la prochaine chute ou la prochaine image autorisee
+        double timeout = -1.0;
+        if (gameField->getGameState() == GameState::PLAYING) {
+            double untilGravity = gameField->getTicksUntilGravity() * GameField::TICK_SECONDS - accumulator;
+            timeout = std::max(0.0, untilGravity);
+        }
+        if (inputController.isBusy()) {
+            // entrees en attente ou touche tenue: reveil au prochain tick
+            double untilNextTick = std::max(0.0, GameField::TICK_SECONDS - accumulator);
+            timeout = timeout < 0.0 ? untilNextTick : std::min(timeout, untilNextTick);
+        }
+        if (changed) {
+            double untilNextFrame = std::max(0.0, 1.0 / maxFps - sinceLastFrame);
+            timeout = timeout < 0.0 ? untilNextFrame : std::min(timeout, untilNextFrame);
+        }
+        
+        PROFILE_ZONE("wait events");
+        plannedWait = std::max(timeout, 0.0);
+        if (timeout < 0.0) {
+            glfwWaitEvents();
+        } else {
+            glfwWaitEventsTimeout(timeout);
+        }
     }
 
+    dumpTrace();
+    if (frameStatsPath.empty()) {
+        Log::flush();
+        frameTimes.printReport();
+    } else {
+        writeFrameTimes();
+    }
+    
+    delete gameRenderer;
     delete gameField;
     glfwTerminate();
     return 0;
-}
\ No newline at end of file
+}